@@ -82,6 +82,30 @@ bool AppClient::start(int argc, const char* argv[])
         return true;
     }
 
+    if (1U < m_opts.clientsCount()) {
+        // The clients are managed by the derived class
+        return startMultiClientImpl();
+    }
+
+    auto sessionStorePath = m_opts.sessionStore();
+    if (!sessionStorePath.empty()) {
+        if (!m_sessionStore.open(sessionStorePath)) {
+            return false;
+        }
+
+        m_sessionStore.attach(m_client.get());
+        if (!m_sessionStore.restore(m_client.get(), nullptr, nullptr)) {
+            return false;
+        }
+
+        if (m_opts.verbose() && (m_sessionStore.pendingCount() > 0U)) {
+            std::cout << "Restored " << m_sessionStore.pendingCount() << " in-flight publish(es)" << std::endl;
+        }
+
+        // The broker may deliver messages for the subscriptions of the previous run
+        ::cc_mqtt311_client_set_verify_incoming_msg_subscribed(m_client.get(), false);
+    }
+
     if (!createSession()) {
         return false;
     }
@@ -108,6 +132,7 @@ std::string AppClient::toString(CC_Mqtt311ErrorCode val)
         "Disconnecting",
         "Network Disconnected",
         "Preparation Locked",
+        "Queue Full",
     };
     static constexpr std::size_t MapSize = std::extent<decltype(Map)>::value;
     static_assert(MapSize == CC_Mqtt311ErrorCode_ValuesLimit);
@@ -320,7 +345,7 @@ bool AppClient::startImpl()
     auto config = CC_Mqtt311ConnectConfig();
     ::cc_mqtt311_client_connect_init_config(&config);
     config.m_keepAlive = m_opts.keepAlive();
-    config.m_cleanSession = true;
+    config.m_cleanSession = m_opts.sessionStore().empty();
 
     if (!clientId.empty()) {
         config.m_clientId = clientId.c_str();
@@ -367,6 +392,12 @@ bool AppClient::startImpl()
     return sendConnect(connect);
 }
 
+bool AppClient::startMultiClientImpl()
+{
+    logError() << "Multiple clients are not supported." << std::endl;
+    return false;
+}
+
 void AppClient::brokerConnectedImpl()
 {
     assert(false); // Expected to be overriden
@@ -513,11 +544,21 @@ bool AppClient::createSession()
         return false;
     }
 
-    m_session->setDataReportCb(
-        [this](const std::uint8_t* buf, std::size_t bufLen) -> unsigned
+    m_session->setInputAcquireCb(
+        [this](std::size_t& len) -> std::uint8_t*
+        {
+            assert(m_client);
+            unsigned bufLen = 0U;
+            auto* buf = ::cc_mqtt311_client_input_buffer_acquire(m_client.get(), &bufLen);
+            len = bufLen;
+            return buf;
+        });
+
+    m_session->setInputCommitCb(
+        [this](std::size_t len)
         {
             assert(m_client);
-            return ::cc_mqtt311_client_process_data(m_client.get(), buf, static_cast<unsigned>(bufLen));
+            ::cc_mqtt311_client_input_buffer_commit(m_client.get(), static_cast<unsigned>(len));
         });
 
     m_session->setNetworkDisconnectedReportCb(
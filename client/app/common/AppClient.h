@@ -9,6 +9,7 @@
 
 #include "ProgramOptions.h"
 #include "Session.h"
+#include "SessionStore.h"
 
 #include "client.h"
 
@@ -41,6 +42,7 @@ public:
     void print(const CC_Mqtt311MessageInfo& info, bool printMessage = true);
     static void print(const CC_Mqtt311ConnectResponse& response);
     static void print(const CC_Mqtt311SubscribeResponse& response);
+    static std::vector<std::uint8_t> parseBinaryData(const std::string& val);
 
 protected:
 
@@ -70,13 +72,12 @@ protected:
     void doComplete();
 
     virtual bool startImpl();
+    virtual bool startMultiClientImpl();
     virtual void brokerConnectedImpl();
     virtual void brokerDisconnectedImpl(CC_Mqtt311BrokerDisconnectReason reason);
     virtual void messageReceivedImpl(const CC_Mqtt311MessageInfo* info);
     virtual void connectCompleteImpl(CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311ConnectResponse* response);
 
-    static std::vector<std::uint8_t> parseBinaryData(const std::string& val);
-
 private:
     using ClientPtr = std::unique_ptr<CC_Mqtt311Client, ClientDeleter>;
     using Timer = boost::asio::steady_timer;
@@ -101,6 +102,7 @@ private:
     Timer m_timer;
     Timestamp m_lastWaitProgram;
     ProgramOptions m_opts;
+    SessionStore m_sessionStore;
     ClientPtr m_client;
     SessionPtr m_session;
 };
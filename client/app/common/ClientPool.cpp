@@ -0,0 +1,610 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ClientPool.h"
+
+#include "AppClient.h"
+#include "Session.h"
+
+#include <boost/asio.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif // #ifdef __linux__
+
+namespace cc_mqtt311_client_app
+{
+
+namespace
+{
+
+std::ostream& logError()
+{
+    return std::cerr << "ERROR: ";
+}
+
+bool pinToCpu(std::thread& thread, unsigned cpu)
+{
+#ifdef __linux__
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus) == 0;
+#else // #ifdef __linux__
+    static_cast<void>(thread);
+    static_cast<void>(cpu);
+    return false;
+#endif // #ifdef __linux__
+}
+
+unsigned cpusCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+} // namespace
+
+class ClientPool::Worker
+{
+public:
+    Worker(ClientPool& pool, unsigned idx) :
+        m_pool(pool),
+        m_idx(idx),
+        m_timer(m_io),
+        m_group(::cc_mqtt311_client_group_alloc()),
+        m_lastTick(Clock::now())
+    {
+        assert(m_group);
+    }
+
+    ~Worker()
+    {
+        join();
+    }
+
+    bool addClient(unsigned clientIdx);
+    void start(bool pin);
+    void stop();
+    void join();
+    bool submit(unsigned clientIdx, PublishRequest&& req);
+
+private:
+    struct ClientDeleter
+    {
+        void operator()(CC_Mqtt311Client* ptr)
+        {
+            ::cc_mqtt311_client_free(ptr);
+        }
+    };
+
+    struct GroupDeleter
+    {
+        void operator()(CC_Mqtt311ClientGroup* ptr)
+        {
+            ::cc_mqtt311_client_group_free(ptr);
+        }
+    };
+
+    using ClientPtr = std::unique_ptr<CC_Mqtt311Client, ClientDeleter>;
+    using GroupPtr = std::unique_ptr<CC_Mqtt311ClientGroup, GroupDeleter>;
+    using Timer = boost::asio::steady_timer;
+    using Clock = Timer::clock_type;
+    using Timestamp = Timer::time_point;
+
+    struct Entry
+    {
+        Worker* m_worker = nullptr;
+        unsigned m_idx = 0U;
+        ClientPtr m_client;
+        SessionPtr m_session;
+    };
+
+    struct PendingPublish
+    {
+        unsigned m_clientIdx = 0U;
+        PublishRequest m_req;
+    };
+
+    using EntryPtr = std::unique_ptr<Entry>;
+    using EntriesList = std::vector<EntryPtr>;
+    using PendingList = std::vector<PendingPublish>;
+
+    void connectAll();
+    bool connect(Entry& entry);
+    void drainQueue();
+    void doPublish(Entry& entry, const PublishRequest& req);
+    void advanceClock();
+    void rearmTimer();
+
+    Entry& entryOf(unsigned clientIdx)
+    {
+        auto pos = clientIdx / m_pool.threadsCount();
+        assert(pos < m_entries.size());
+        return *m_entries[pos];
+    }
+
+    static Entry* asEntry(void* data)
+    {
+        return reinterpret_cast<Entry*>(data);
+    }
+
+    static void sendDataCb(void* data, const unsigned char* buf, unsigned bufLen);
+    static void brokerDisconnectedCb(void* data, CC_Mqtt311BrokerDisconnectReason reason);
+    static void messageReceivedCb(void* data, const CC_Mqtt311MessageInfo* info);
+    static void logMessageCb(void* data, const char* msg);
+    static void connectCompleteCb(void* data, CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311ConnectResponse* response);
+    static void publishCompleteCb(void* data, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
+
+    ClientPool& m_pool;
+    unsigned m_idx = 0U;
+    boost::asio::io_context m_io;
+    Timer m_timer;
+    GroupPtr m_group;
+    Timestamp m_lastTick;
+    Timestamp m_armedDeadline;
+    bool m_armed = false;
+    EntriesList m_entries; // Destructed first, the freed clients leave the group
+    std::mutex m_queueMutex;
+    PendingList m_queue;
+    PendingList m_draining;
+    bool m_stopped = false; // Guarded by m_queueMutex
+    std::thread m_thread;
+};
+
+bool ClientPool::Worker::addClient(unsigned clientIdx)
+{
+    auto entry = std::make_unique<Entry>();
+    entry->m_worker = this;
+    entry->m_idx = clientIdx;
+    entry->m_client.reset(::cc_mqtt311_client_alloc());
+    if (!entry->m_client) {
+        logError() << "Failed to allocate client " << clientIdx << std::endl;
+        return false;
+    }
+
+    auto* client = entry->m_client.get();
+    ::cc_mqtt311_client_set_send_output_data_callback(client, &Worker::sendDataCb, entry.get());
+    ::cc_mqtt311_client_set_broker_disconnect_report_callback(client, &Worker::brokerDisconnectedCb, entry.get());
+    ::cc_mqtt311_client_set_message_received_report_callback(client, &Worker::messageReceivedCb, entry.get());
+    ::cc_mqtt311_client_set_error_log_callback(client, &Worker::logMessageCb, entry.get());
+
+    auto ec = ::cc_mqtt311_client_group_add(m_group.get(), client);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        logError() << "Failed to add client " << clientIdx << " to the group with ec=" << AppClient::toString(ec) << std::endl;
+        return false;
+    }
+
+    m_entries.push_back(std::move(entry));
+    return true;
+}
+
+void ClientPool::Worker::start(bool pin)
+{
+    boost::asio::post(
+        m_io,
+        [this]()
+        {
+            connectAll();
+        });
+
+    m_thread =
+        std::thread(
+            [this]()
+            {
+                auto guard = boost::asio::make_work_guard(m_io);
+                m_io.run();
+            });
+
+    if (pin && (!pinToCpu(m_thread, m_idx % cpusCount()))) {
+        logError() << "Failed to pin worker thread " << m_idx << std::endl;
+    }
+}
+
+void ClientPool::Worker::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        if (m_stopped) {
+            return;
+        }
+
+        m_stopped = true;
+    }
+
+    boost::asio::post(
+        m_io,
+        [this]()
+        {
+            // The requests accepted before the stop are still published
+            drainQueue();
+
+            for (auto& entry : m_entries) {
+                auto* client = entry->m_client.get();
+                if (!::cc_mqtt311_client_is_connected(client)) {
+                    continue;
+                }
+
+                auto ec = ::cc_mqtt311_client_disconnect(client);
+                if (ec != CC_Mqtt311ErrorCode_Success) {
+                    logError() << "Failed to send disconnect for client " << entry->m_idx << " with ec=" << AppClient::toString(ec) << std::endl;
+                }
+            }
+
+            m_timer.cancel();
+            boost::asio::post(
+                m_io,
+                [this]()
+                {
+                    m_io.stop();
+                });
+        });
+}
+
+void ClientPool::Worker::join()
+{
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool ClientPool::Worker::submit(unsigned clientIdx, PublishRequest&& req)
+{
+    bool wasEmpty = false;
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        if (m_stopped) {
+            return false;
+        }
+
+        wasEmpty = m_queue.empty();
+        m_queue.push_back(PendingPublish{clientIdx, std::move(req)});
+    }
+
+    if (!wasEmpty) {
+        // The drain of the whole batch has already been scheduled
+        return true;
+    }
+
+    boost::asio::post(
+        m_io,
+        [this]()
+        {
+            drainQueue();
+        });
+    return true;
+}
+
+void ClientPool::Worker::connectAll()
+{
+    advanceClock();
+    for (auto& entry : m_entries) {
+        if (connect(*entry)) {
+            continue;
+        }
+
+        if (m_pool.m_disconnectedCb) {
+            m_pool.m_disconnectedCb(entry->m_idx);
+        }
+    }
+    rearmTimer();
+}
+
+bool ClientPool::Worker::connect(Entry& entry)
+{
+    auto& opts = m_pool.m_opts;
+    entry.m_session = Session::create(m_io, opts);
+    if (!entry.m_session) {
+        logError() << "Failed to create network connection session for client " << entry.m_idx << std::endl;
+        return false;
+    }
+
+    auto* client = entry.m_client.get();
+    entry.m_session->setInputAcquireCb(
+        [client](std::size_t& len) -> std::uint8_t*
+        {
+            unsigned bufLen = 0U;
+            auto* buf = ::cc_mqtt311_client_input_buffer_acquire(client, &bufLen);
+            len = bufLen;
+            return buf;
+        });
+
+    entry.m_session->setInputCommitCb(
+        [this, client](std::size_t len)
+        {
+            advanceClock();
+            ::cc_mqtt311_client_input_buffer_commit(client, static_cast<unsigned>(len));
+            rearmTimer();
+        });
+
+    entry.m_session->setNetworkDisconnectedReportCb(
+        [this, client]()
+        {
+            advanceClock();
+            ::cc_mqtt311_client_notify_network_disconnected(client);
+            rearmTimer();
+        });
+
+    if (!entry.m_session->start()) {
+        logError() << "Failed to connect client " << entry.m_idx << " to the broker." << std::endl;
+        return false;
+    }
+
+    auto clientId = opts.clientId();
+    if (!clientId.empty()) {
+        clientId += '_' + std::to_string(entry.m_idx);
+    }
+
+    auto username = opts.username();
+    auto password = AppClient::parseBinaryData(opts.password());
+
+    auto config = CC_Mqtt311ConnectConfig();
+    ::cc_mqtt311_client_connect_init_config(&config);
+    config.m_keepAlive = opts.keepAlive();
+    config.m_cleanSession = true;
+
+    if (!clientId.empty()) {
+        config.m_clientId = clientId.c_str();
+    }
+
+    if (!username.empty()) {
+        config.m_username = username.c_str();
+    }
+
+    if (!password.empty()) {
+        config.m_password = &password[0];
+        config.m_passwordLen = static_cast<decltype(config.m_passwordLen)>(password.size());
+    }
+
+    auto ec = ::cc_mqtt311_client_connect(client, &config, nullptr, &Worker::connectCompleteCb, &entry);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        logError() << "Failed to send connect request for client " << entry.m_idx << " with ec=" << AppClient::toString(ec) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void ClientPool::Worker::drainQueue()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        m_draining.swap(m_queue);
+    }
+
+    advanceClock();
+    for (auto& pending : m_draining) {
+        doPublish(entryOf(pending.m_clientIdx), pending.m_req);
+    }
+    m_draining.clear();
+    rearmTimer();
+}
+
+void ClientPool::Worker::doPublish(Entry& entry, const PublishRequest& req)
+{
+    auto config = CC_Mqtt311PublishConfig();
+    ::cc_mqtt311_client_publish_init_config(&config);
+    config.m_topic = req.m_topic.c_str();
+    if (!req.m_data.empty()) {
+        config.m_data = &req.m_data[0];
+    }
+    config.m_dataLen = static_cast<decltype(config.m_dataLen)>(req.m_data.size());
+    config.m_qos = req.m_qos;
+    config.m_retain = req.m_retain;
+
+    auto ec = ::cc_mqtt311_client_publish(entry.m_client.get(), &config, &Worker::publishCompleteCb, &entry);
+    if (ec == CC_Mqtt311ErrorCode_Success) {
+        return;
+    }
+
+    logError() << "Failed to publish via client " << entry.m_idx << " with ec=" << AppClient::toString(ec) << std::endl;
+    if (m_pool.m_publishCompleteCb) {
+        m_pool.m_publishCompleteCb(entry.m_idx, CC_Mqtt311AsyncOpStatus_InternalError);
+    }
+}
+
+void ClientPool::Worker::advanceClock()
+{
+    auto now = Clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastTick);
+    if (elapsed.count() == 0) {
+        return;
+    }
+
+    // The sub-millisecond remainder is reported on the next advance
+    m_lastTick += elapsed;
+    ::cc_mqtt311_client_group_tick(m_group.get(), static_cast<unsigned>(elapsed.count()));
+}
+
+void ClientPool::Worker::rearmTimer()
+{
+    auto next = ::cc_mqtt311_client_group_next_tick(m_group.get());
+    if (next == 0U) {
+        if (m_armed) {
+            m_armed = false;
+            m_timer.cancel();
+        }
+        return;
+    }
+
+    auto deadline = m_lastTick + std::chrono::milliseconds(next);
+    if (m_armed && (deadline == m_armedDeadline)) {
+        return;
+    }
+
+    m_armed = true;
+    m_armedDeadline = deadline;
+    m_timer.expires_at(deadline);
+    m_timer.async_wait(
+        [this](const boost::system::error_code& ec)
+        {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+
+            if (ec) {
+                logError() << "Timer error: " << ec.message() << std::endl;
+                return;
+            }
+
+            m_armed = false;
+            advanceClock();
+            rearmTimer();
+        });
+}
+
+void ClientPool::Worker::sendDataCb(void* data, const unsigned char* buf, unsigned bufLen)
+{
+    auto* entry = asEntry(data);
+    assert(entry->m_session);
+    entry->m_session->sendData(buf, bufLen);
+}
+
+void ClientPool::Worker::brokerDisconnectedCb(void* data, [[maybe_unused]] CC_Mqtt311BrokerDisconnectReason reason)
+{
+    auto* entry = asEntry(data);
+    auto& pool = entry->m_worker->m_pool;
+    if (pool.m_disconnectedCb) {
+        pool.m_disconnectedCb(entry->m_idx);
+    }
+}
+
+void ClientPool::Worker::messageReceivedCb(void* data, const CC_Mqtt311MessageInfo* info)
+{
+    auto* entry = asEntry(data);
+    auto& pool = entry->m_worker->m_pool;
+    assert(info != nullptr);
+    if (pool.m_messageReceivedCb) {
+        pool.m_messageReceivedCb(entry->m_idx, *info);
+    }
+}
+
+void ClientPool::Worker::logMessageCb(void* data, const char* msg)
+{
+    logError() << "Client " << asEntry(data)->m_idx << ": " << msg << std::endl;
+}
+
+void ClientPool::Worker::connectCompleteCb(void* data, CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311ConnectResponse* response)
+{
+    auto* entry = asEntry(data);
+    auto& pool = entry->m_worker->m_pool;
+    if ((status == CC_Mqtt311AsyncOpStatus_Complete) &&
+        (response != nullptr) &&
+        (response->m_returnCode == CC_Mqtt311ConnectReturnCode_Accepted)) {
+        if (pool.m_connectedCb) {
+            pool.m_connectedCb(entry->m_idx);
+        }
+        return;
+    }
+
+    logError() << "Connection of client " << entry->m_idx << " failed with status=" << AppClient::toString(status) << std::endl;
+    if (pool.m_disconnectedCb) {
+        pool.m_disconnectedCb(entry->m_idx);
+    }
+}
+
+void ClientPool::Worker::publishCompleteCb(void* data, [[maybe_unused]] CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status)
+{
+    auto* entry = asEntry(data);
+    if (status != CC_Mqtt311AsyncOpStatus_Complete) {
+        logError() << "Publish via client " << entry->m_idx << " failed with status=" << AppClient::toString(status) << std::endl;
+    }
+
+    auto& pool = entry->m_worker->m_pool;
+    if (pool.m_publishCompleteCb) {
+        pool.m_publishCompleteCb(entry->m_idx, status);
+    }
+}
+
+ClientPool::ClientPool(const ProgramOptions& opts, unsigned threadsCount) :
+    m_opts(opts),
+    m_requestedThreads(threadsCount)
+{
+}
+
+ClientPool::~ClientPool()
+{
+    stop();
+}
+
+bool ClientPool::start(unsigned clientsCount)
+{
+    if (m_running || (clientsCount == 0U)) {
+        return false;
+    }
+
+    // Workers of the previous run
+    m_workers.clear();
+    m_clientsCount = 0U;
+
+    auto threads = m_requestedThreads;
+    if (threads == 0U) {
+        threads = cpusCount();
+    }
+
+    // No idle workers
+    threads = std::min(threads, clientsCount);
+    m_workers.reserve(threads);
+    for (auto idx = 0U; idx < threads; ++idx) {
+        m_workers.push_back(std::make_unique<Worker>(*this, idx));
+    }
+
+    // The clients are allocated before any worker thread is running,
+    // the allocation logic of the library doesn't need to be locked.
+    m_clientsCount = clientsCount;
+    for (auto idx = 0U; idx < clientsCount; ++idx) {
+        if (!m_workers[threadOf(idx)]->addClient(idx)) {
+            m_workers.clear();
+            m_clientsCount = 0U;
+            return false;
+        }
+    }
+
+    for (auto& worker : m_workers) {
+        worker->start(m_cpuPinning);
+    }
+
+    m_running = true;
+    return true;
+}
+
+void ClientPool::stop()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    for (auto& worker : m_workers) {
+        worker->stop();
+    }
+
+    // The workers are not destructed, the publish() invoked by other 
+    // threads can still access them.
+    for (auto& worker : m_workers) {
+        worker->join();
+    }
+}
+
+bool ClientPool::publish(unsigned clientIdx, PublishRequest&& req)
+{
+    // The clients count and the workers list are modified only by start()
+    if (m_clientsCount <= clientIdx) {
+        return false;
+    }
+
+    return m_workers[threadOf(clientIdx)]->submit(clientIdx, std::move(req));
+}
+
+} // namespace cc_mqtt311_client_app
@@ -0,0 +1,120 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ProgramOptions.h"
+
+#include "client.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cc_mqtt311_client_app
+{
+
+// Distributes the clients between the worker threads, each running its own
+// io_context and driving its clients via a single client group timer.
+// Every client is accessed only by the thread of the owning worker, the
+// publish requests submitted from other threads are handed over via
+// the queue of that worker.
+// The start(), stop() and destruction are performed by the owning thread,
+// the publish() can be invoked from any thread, also concurrently with stop().
+// The stopped workers are kept until the next start() or destruction and
+// reject the late publish requests.
+class ClientPool
+{
+public:
+    struct PublishRequest
+    {
+        std::string m_topic;
+        std::vector<std::uint8_t> m_data;
+        CC_Mqtt311QoS m_qos = CC_Mqtt311QoS_AtMostOnceDelivery;
+        bool m_retain = false;
+    };
+
+    // The callbacks are invoked on the thread of the worker owning the client
+    using ConnectedCb = std::function<void (unsigned clientIdx)>;
+    using DisconnectedCb = std::function<void (unsigned clientIdx)>;
+    using MessageReceivedCb = std::function<void (unsigned clientIdx, const CC_Mqtt311MessageInfo& info)>;
+    using PublishCompleteCb = std::function<void (unsigned clientIdx, CC_Mqtt311AsyncOpStatus status)>;
+
+    // Zero threads count stands for the number of the available CPUs
+    ClientPool(const ProgramOptions& opts, unsigned threadsCount = 0U);
+    ~ClientPool();
+
+    template <typename TFunc>
+    void setConnectedCb(TFunc&& func)
+    {
+        m_connectedCb = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setDisconnectedCb(TFunc&& func)
+    {
+        m_disconnectedCb = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setMessageReceivedCb(TFunc&& func)
+    {
+        m_messageReceivedCb = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setPublishCompleteCb(TFunc&& func)
+    {
+        m_publishCompleteCb = std::forward<TFunc>(func);
+    }
+
+    void setCpuPinning(bool value)
+    {
+        m_cpuPinning = value;
+    }
+
+    bool start(unsigned clientsCount);
+    void stop();
+
+    // Can be invoked from any thread, returns false when the pool is stopped
+    bool publish(unsigned clientIdx, PublishRequest&& req);
+
+    unsigned threadsCount() const
+    {
+        return static_cast<unsigned>(m_workers.size());
+    }
+
+    unsigned clientsCount() const
+    {
+        return m_clientsCount;
+    }
+
+    unsigned threadOf(unsigned clientIdx) const
+    {
+        return clientIdx % threadsCount();
+    }
+
+private:
+    class Worker;
+    using WorkerPtr = std::unique_ptr<Worker>;
+    using WorkersList = std::vector<WorkerPtr>;
+
+    const ProgramOptions& m_opts;
+    unsigned m_requestedThreads = 0U;
+    unsigned m_clientsCount = 0U;
+    bool m_cpuPinning = true;
+    bool m_running = false;
+    ConnectedCb m_connectedCb;
+    DisconnectedCb m_disconnectedCb;
+    MessageReceivedCb m_messageReceivedCb;
+    PublishCompleteCb m_publishCompleteCb;
+    WorkersList m_workers;
+};
+
+} // namespace cc_mqtt311_client_app
@@ -39,6 +39,9 @@ void ProgramOptions::addConnect()
             "Applicable only if will-topic is set.")
         ("will-qos", po::value<unsigned>()->default_value(0U), "Will Message QoS: 0, 1, or 2")            
         ("will-retain", "Set \"retain\" flag on the will message.")            
+        ("session-store", po::value<std::string>()->default_value(std::string()), 
+            "Path to the file persisting in-flight QoS1/QoS2 publishes. When set, "
+            "the session is not cleaned on connect and the stored publishes are resumed.")
     ;    
 
     m_desc.add(opts);
@@ -100,6 +103,19 @@ void ProgramOptions::addSubscribe()
     m_desc.add(opts);
 }
 
+void ProgramOptions::addMultiClient()
+{
+    po::options_description opts("Multiple Clients Options");
+    opts.add_options()
+        ("clients", po::value<unsigned>()->default_value(1U), "Number of clients performing the operation in parallel, "
+            "each uses its own connection to the broker.")
+        ("threads", po::value<unsigned>()->default_value(0U), "Number of worker threads driving the clients, 0 stands for "
+            "the number of available CPUs. Applicable only when more than one client is used.")
+    ;    
+
+    m_desc.add(opts);
+}
+
 void ProgramOptions::printHelp()
 {
     std::cout << m_desc << std::endl;
@@ -229,6 +245,11 @@ bool ProgramOptions::willRetain() const
     return m_vm.count("will-retain") > 0U;
 }
 
+std::string ProgramOptions::sessionStore() const
+{
+    return m_vm["session-store"].as<std::string>();
+}
+
 std::string ProgramOptions::pubTopic() const
 {
     return m_vm["pub-topic"].as<std::string>();
@@ -275,6 +296,26 @@ bool ProgramOptions::subBinary() const
     return m_vm.count("sub-binary") > 0U;
 }
 
+unsigned ProgramOptions::clientsCount() const
+{
+    auto* id = "clients";
+    if (m_vm.count(id) == 0U) {
+        return 1U;
+    }
+
+    return m_vm[id].as<unsigned>();
+}
+
+unsigned ProgramOptions::threadsCount() const
+{
+    auto* id = "threads";
+    if (m_vm.count(id) == 0U) {
+        return 0U;
+    }
+
+    return m_vm[id].as<unsigned>();
+}
+
 ProgramOptions::StringsList ProgramOptions::stringListOpts(const std::string& name) const
 {
     StringsList result;
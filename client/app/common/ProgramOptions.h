@@ -38,6 +38,7 @@ public:
     void addTls();
     void addPublish();
     void addSubscribe();
+    void addMultiClient();
 
     void printHelp();
 
@@ -68,6 +69,7 @@ public:
     std::string willMessage() const;
     unsigned willQos() const;
     bool willRetain() const;
+    std::string sessionStore() const;
 
     // Publish Options
     std::string pubTopic() const;
@@ -81,6 +83,10 @@ public:
     bool subNoRetained() const;
     bool subBinary() const;
 
+    // Multiple Clients Options
+    unsigned clientsCount() const;
+    unsigned threadsCount() const;
+
 private:
     StringsList stringListOpts(const std::string& name) const;
 
@@ -53,10 +53,16 @@ std::ostream& Session::logError()
     return std::cerr << "ERROR: ";
 }
 
-unsigned Session::reportData(const std::uint8_t* buf, std::size_t bufLen)
+std::uint8_t* Session::acquireInput(std::size_t& len)
 {
-    assert(m_dataReportCb);
-    return m_dataReportCb(buf, bufLen);
+    assert(m_inputAcquireCb);
+    return m_inputAcquireCb(len);
+}
+
+void Session::commitInput(std::size_t len)
+{
+    assert(m_inputCommitCb);
+    m_inputCommitCb(len);
 }
 
 void Session::reportNetworkDisconnected()
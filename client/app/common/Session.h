@@ -36,11 +36,18 @@ public:
         sendDataImpl(buf, bufLen);
     }
 
-    using DataReportCb = std::function<unsigned (const std::uint8_t* buf, std::size_t bufLen)>;
+    using InputAcquireCb = std::function<std::uint8_t* (std::size_t& len)>;
     template <typename TFunc>
-    void setDataReportCb(TFunc&& func)
+    void setInputAcquireCb(TFunc&& func)
     {
-        m_dataReportCb = std::forward<TFunc>(func);
+        m_inputAcquireCb = std::forward<TFunc>(func);
+    }
+
+    using InputCommitCb = std::function<void (std::size_t len)>;
+    template <typename TFunc>
+    void setInputCommitCb(TFunc&& func)
+    {
+        m_inputCommitCb = std::forward<TFunc>(func);
     }
 
     using NetworkDisconnectedReportCb = std::function<void ()>;
@@ -66,7 +73,8 @@ protected:
 
     static std::ostream& logError();
 
-    unsigned reportData(const std::uint8_t* buf, std::size_t bufLen);
+    std::uint8_t* acquireInput(std::size_t& len);
+    void commitInput(std::size_t len);
     void reportNetworkDisconnected();
 
     virtual bool startImpl() = 0;
@@ -75,7 +83,8 @@ protected:
 private:
     boost::asio::io_context& m_io; 
     const ProgramOptions& m_opts;
-    DataReportCb m_dataReportCb;
+    InputAcquireCb m_inputAcquireCb;
+    InputCommitCb m_inputCommitCb;
     NetworkDisconnectedReportCb m_networkDisconnectedReportCb;
     bool m_networkDisconnected = false;
 };
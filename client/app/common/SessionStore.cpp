@@ -0,0 +1,397 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "SessionStore.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+namespace cc_mqtt311_client_app
+{
+
+namespace
+{
+
+// File layout:
+//   - Header: magic (4 bytes), version (4 bytes), used log length (8 bytes)
+//   - Log of records: type (1 byte), flags (1 byte), packet ID (2 bytes),
+//     for "publish" records: topic length (2 bytes), data length (4 bytes), topic, data.
+// All the numeric values are little endian.
+
+const std::uint8_t Magic[] = {'C', 'C', 'M', 'S'};
+const std::uint32_t Version = 1U;
+const std::size_t MagicSize = std::extent<decltype(Magic)>::value;
+const std::size_t UsedOffset = MagicSize + sizeof(Version);
+const std::size_t HeaderSize = UsedOffset + sizeof(std::uint64_t);
+const std::size_t RecordBaseSize = 4U;
+const std::size_t PublishRecordExtraSize = 6U;
+const std::size_t MinFileSize = 64U * 1024U;
+const std::size_t CompactMinUsed = 64U * 1024U;
+const std::size_t CompactRatio = 4U;
+const std::uint8_t QosMask = 0x3;
+const std::uint8_t RetainFlag = 0x4;
+
+SessionStore* asThis(void* data)
+{
+    return reinterpret_cast<SessionStore*>(data);
+}
+
+std::ostream& logError()
+{
+    return std::cerr << "ERROR: ";
+}
+
+template <typename T>
+void writeValue(T value, std::vector<std::uint8_t>& buf)
+{
+    for (auto idx = 0U; idx < sizeof(T); ++idx) {
+        buf.push_back(static_cast<std::uint8_t>(value >> (idx * 8U)));
+    }
+}
+
+template <typename T>
+T readValue(const std::uint8_t* iter)
+{
+    T value = 0U;
+    for (auto idx = 0U; idx < sizeof(T); ++idx) {
+        value |= static_cast<T>(static_cast<T>(iter[idx]) << (idx * 8U));
+    }
+    return value;
+}
+
+} // namespace
+
+SessionStore::~SessionStore()
+{
+    unmapFile();
+}
+
+bool SessionStore::open(const std::string& path)
+{
+    m_path = path;
+    m_entries.clear();
+    m_entriesMap.clear();
+
+    try {
+        std::error_code ec;
+        auto fileSize = std::filesystem::file_size(m_path, ec);
+        if ((!ec) && (HeaderSize <= fileSize)) {
+            if (!mapFile(static_cast<std::size_t>(fileSize))) {
+                return false;
+            }
+
+            if (!load()) {
+                logError() << "Invalid session store file: " << m_path << std::endl;
+                return false;
+            }
+        }
+
+        // Rewrite the file with live records only to speed up next start
+        return compact();
+    }
+    catch (const std::exception& e) {
+        logError() << "Failed to open session store " << m_path << ": " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void SessionStore::attach(CC_Mqtt311ClientHandle client)
+{
+    ::cc_mqtt311_client_set_session_store_callback(client, &SessionStore::sessionStoreCb, this);
+}
+
+bool SessionStore::restore(CC_Mqtt311ClientHandle client, CC_Mqtt311PublishCompleteCb cb, void* cbData)
+{
+    for (auto& entry : m_entries) {
+        auto config = CC_Mqtt311PublishRestoreConfig();
+        ::cc_mqtt311_client_publish_init_restore_config(&config);
+
+        config.m_config.m_topic = entry.m_topic.c_str();
+        if (!entry.m_data.empty()) {
+            config.m_config.m_data = &entry.m_data[0];
+        }
+        config.m_config.m_dataLen = static_cast<decltype(config.m_config.m_dataLen)>(entry.m_data.size());
+        config.m_config.m_qos = entry.m_qos;
+        config.m_config.m_retain = entry.m_retain;
+        config.m_packetId = entry.m_packetId;
+        config.m_pubrecReceived = entry.m_pubrecReceived;
+
+        auto ec = ::cc_mqtt311_client_publish_restore(client, &config, cb, cbData);
+        if (ec != CC_Mqtt311ErrorCode_Success) {
+            logError() << "Failed to restore publish with packet ID " << entry.m_packetId << ", ec=" << ec << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SessionStore::applyRecord(const CC_Mqtt311SessionStoreRecord& record)
+{
+    auto iter = m_entriesMap.find(record.m_packetId);
+    if (record.m_type == CC_Mqtt311SessionStoreRecordType_Publish) {
+        if (iter != m_entriesMap.end()) {
+            m_entries.erase(iter->second);
+            m_entriesMap.erase(iter);
+        }
+
+        Entry entry;
+        entry.m_packetId = record.m_packetId;
+        if (record.m_topic != nullptr) {
+            entry.m_topic = record.m_topic;
+        }
+
+        if (record.m_dataLen > 0U) {
+            entry.m_data.assign(record.m_data, record.m_data + record.m_dataLen);
+        }
+
+        entry.m_qos = record.m_qos;
+        entry.m_retain = record.m_retain;
+        m_entries.push_back(std::move(entry));
+        m_entriesMap[record.m_packetId] = std::prev(m_entries.end());
+        return;
+    }
+
+    if (iter == m_entriesMap.end()) {
+        return;
+    }
+
+    if (record.m_type == CC_Mqtt311SessionStoreRecordType_Pubrec) {
+        iter->second->m_pubrecReceived = true;
+        return;
+    }
+
+    m_entries.erase(iter->second);
+    m_entriesMap.erase(iter);
+}
+
+void SessionStore::appendRecord(const CC_Mqtt311SessionStoreRecord& record)
+{
+    m_buf.clear();
+    serialize(record, m_buf);
+
+    bool compactRequired =
+        (m_region.get_size() < (HeaderSize + m_used + m_buf.size())) ||
+        ((CompactMinUsed < m_used) && ((liveBytes() * CompactRatio) < m_used));
+
+    if (compactRequired) {
+        // The record is already applied to the entries
+        compact();
+        return;
+    }
+
+    auto* logStart = static_cast<std::uint8_t*>(m_region.get_address()) + HeaderSize;
+    std::copy(m_buf.begin(), m_buf.end(), logStart + m_used);
+    m_region.flush(HeaderSize + m_used, m_buf.size(), true);
+    m_used += m_buf.size();
+    writeUsed();
+}
+
+bool SessionStore::load()
+{
+    auto* begin = static_cast<const std::uint8_t*>(m_region.get_address());
+    auto size = m_region.get_size();
+    if ((size < HeaderSize) ||
+        (!std::equal(std::begin(Magic), std::end(Magic), begin)) ||
+        (readValue<std::uint32_t>(begin + MagicSize) != Version)) {
+        return false;
+    }
+
+    auto used = std::min(static_cast<std::size_t>(readValue<std::uint64_t>(begin + UsedOffset)), size - HeaderSize);
+    auto* iter = begin + HeaderSize;
+    auto* end = iter + used;
+    std::string topic;
+    while (RecordBaseSize <= static_cast<std::size_t>(std::distance(iter, end))) {
+        auto record = CC_Mqtt311SessionStoreRecord();
+        record.m_type = static_cast<decltype(record.m_type)>(iter[0]);
+        record.m_qos = static_cast<decltype(record.m_qos)>(iter[1] & QosMask);
+        record.m_retain = ((iter[1] & RetainFlag) != 0U);
+        record.m_packetId = readValue<std::uint16_t>(iter + 2);
+
+        if (CC_Mqtt311SessionStoreRecordType_ValuesLimit <= record.m_type) {
+            break;
+        }
+
+        auto recordLen = RecordBaseSize;
+        if (record.m_type == CC_Mqtt311SessionStoreRecordType_Publish) {
+            if (static_cast<std::size_t>(std::distance(iter, end)) < (RecordBaseSize + PublishRecordExtraSize)) {
+                break;
+            }
+
+            auto topicLen = readValue<std::uint16_t>(iter + RecordBaseSize);
+            auto dataLen = readValue<std::uint32_t>(iter + RecordBaseSize + 2U);
+            recordLen += PublishRecordExtraSize + topicLen + dataLen;
+            if (static_cast<std::size_t>(std::distance(iter, end)) < recordLen) {
+                break; // Incomplete record at the tail
+            }
+
+            auto* topicStart = iter + RecordBaseSize + PublishRecordExtraSize;
+            topic.assign(reinterpret_cast<const char*>(topicStart), topicLen);
+            record.m_topic = topic.c_str();
+            record.m_data = topicStart + topicLen;
+            record.m_dataLen = dataLen;
+        }
+
+        applyRecord(record);
+        iter += recordLen;
+    }
+
+    m_used = static_cast<std::size_t>(std::distance(begin + HeaderSize, iter));
+    return true;
+}
+
+bool SessionStore::compact()
+{
+    DataBuf buf;
+    buf.insert(buf.end(), std::begin(Magic), std::end(Magic));
+    writeValue(Version, buf);
+    writeValue(std::uint64_t(0U), buf);
+    for (auto& entry : m_entries) {
+        serialize(entry, buf);
+    }
+
+    auto used = buf.size() - HeaderSize;
+    auto* usedIter = &buf[UsedOffset];
+    for (auto idx = 0U; idx < sizeof(std::uint64_t); ++idx) {
+        usedIter[idx] = static_cast<std::uint8_t>(static_cast<std::uint64_t>(used) >> (idx * 8U));
+    }
+
+    auto fileSize = std::max(MinFileSize, buf.size() * 2U);
+    auto tmpPath = m_path + ".tmp";
+
+    try {
+        {
+            std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!stream) {
+                logError() << "Failed to create " << tmpPath << std::endl;
+                return false;
+            }
+
+            stream.write(reinterpret_cast<const char*>(&buf[0]), static_cast<std::streamsize>(buf.size()));
+            if (!stream) {
+                logError() << "Failed to write " << tmpPath << std::endl;
+                return false;
+            }
+        }
+
+        std::filesystem::resize_file(tmpPath, fileSize);
+        unmapFile();
+        std::filesystem::rename(tmpPath, m_path);
+        if (!mapFile(fileSize)) {
+            return false;
+        }
+    }
+    catch (const std::exception& e) {
+        logError() << "Failed to compact session store " << m_path << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    m_used = used;
+    return true;
+}
+
+bool SessionStore::mapFile(std::size_t size)
+{
+    boost::interprocess::file_mapping mapping(m_path.c_str(), boost::interprocess::read_write);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_write, 0, size);
+    m_mapping.swap(mapping);
+    m_region.swap(region);
+    return m_region.get_size() == size;
+}
+
+void SessionStore::unmapFile()
+{
+    boost::interprocess::mapped_region region;
+    boost::interprocess::file_mapping mapping;
+    m_region.swap(region);
+    m_mapping.swap(mapping);
+}
+
+void SessionStore::writeUsed()
+{
+    auto* usedIter = static_cast<std::uint8_t*>(m_region.get_address()) + UsedOffset;
+    for (auto idx = 0U; idx < sizeof(std::uint64_t); ++idx) {
+        usedIter[idx] = static_cast<std::uint8_t>(static_cast<std::uint64_t>(m_used) >> (idx * 8U));
+    }
+    m_region.flush(UsedOffset, sizeof(std::uint64_t), true);
+}
+
+std::size_t SessionStore::liveBytes() const
+{
+    std::size_t result = 0U;
+    for (auto& entry : m_entries) {
+        result += RecordBaseSize + PublishRecordExtraSize + entry.m_topic.size() + entry.m_data.size();
+        if (entry.m_pubrecReceived) {
+            result += RecordBaseSize;
+        }
+    }
+    return result;
+}
+
+void SessionStore::serialize(const CC_Mqtt311SessionStoreRecord& record, DataBuf& buf)
+{
+    auto flags = static_cast<std::uint8_t>(record.m_qos & QosMask);
+    if (record.m_retain) {
+        flags |= RetainFlag;
+    }
+
+    buf.push_back(static_cast<std::uint8_t>(record.m_type));
+    buf.push_back(flags);
+    writeValue(static_cast<std::uint16_t>(record.m_packetId), buf);
+    if (record.m_type != CC_Mqtt311SessionStoreRecordType_Publish) {
+        return;
+    }
+
+    auto topicLen = (record.m_topic == nullptr) ? 0U : std::strlen(record.m_topic);
+    writeValue(static_cast<std::uint16_t>(topicLen), buf);
+    writeValue(static_cast<std::uint32_t>(record.m_dataLen), buf);
+    buf.insert(buf.end(), record.m_topic, record.m_topic + topicLen);
+    if (record.m_dataLen > 0U) {
+        buf.insert(buf.end(), record.m_data, record.m_data + record.m_dataLen);
+    }
+}
+
+void SessionStore::serialize(const Entry& entry, DataBuf& buf)
+{
+    auto record = CC_Mqtt311SessionStoreRecord();
+    record.m_type = CC_Mqtt311SessionStoreRecordType_Publish;
+    record.m_packetId = entry.m_packetId;
+    record.m_topic = entry.m_topic.c_str();
+    if (!entry.m_data.empty()) {
+        record.m_data = &entry.m_data[0];
+    }
+    record.m_dataLen = static_cast<decltype(record.m_dataLen)>(entry.m_data.size());
+    record.m_qos = entry.m_qos;
+    record.m_retain = entry.m_retain;
+    serialize(record, buf);
+
+    if (entry.m_pubrecReceived) {
+        record.m_type = CC_Mqtt311SessionStoreRecordType_Pubrec;
+        serialize(record, buf);
+    }
+}
+
+void SessionStore::sessionStoreCb(void* data, const CC_Mqtt311SessionStoreRecord* record)
+{
+    assert(record != nullptr);
+    auto* store = asThis(data);
+    store->applyRecord(*record);
+    try {
+        store->appendRecord(*record);
+    }
+    catch (const std::exception& e) {
+        logError() << "Failed to update session store: " << e.what() << std::endl;
+    }
+}
+
+} // namespace cc_mqtt311_client_app
@@ -0,0 +1,80 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "client.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace cc_mqtt311_client_app
+{
+
+// Reference implementation of the persistent session store.
+// The records reported by the client library are appended to the
+// memory mapped file. The file is compacted (only live records are
+// kept) on open and when the obsolete records start dominating.
+class SessionStore
+{
+public:
+    SessionStore() = default;
+    ~SessionStore();
+
+    bool open(const std::string& path);
+    void attach(CC_Mqtt311ClientHandle client);
+    bool restore(CC_Mqtt311ClientHandle client, CC_Mqtt311PublishCompleteCb cb, void* cbData);
+
+    std::size_t pendingCount() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    struct Entry
+    {
+        unsigned m_packetId = 0U;
+        std::string m_topic;
+        std::vector<std::uint8_t> m_data;
+        CC_Mqtt311QoS m_qos = CC_Mqtt311QoS_AtMostOnceDelivery;
+        bool m_retain = false;
+        bool m_pubrecReceived = false;
+    };
+
+    using EntriesList = std::list<Entry>;
+    using EntriesMap = std::map<unsigned, EntriesList::iterator>;
+    using DataBuf = std::vector<std::uint8_t>;
+
+    void applyRecord(const CC_Mqtt311SessionStoreRecord& record);
+    void appendRecord(const CC_Mqtt311SessionStoreRecord& record);
+    bool load();
+    bool compact();
+    bool mapFile(std::size_t size);
+    void unmapFile();
+    void writeUsed();
+    std::size_t liveBytes() const;
+
+    static void serialize(const CC_Mqtt311SessionStoreRecord& record, DataBuf& buf);
+    static void serialize(const Entry& entry, DataBuf& buf);
+    static void sessionStoreCb(void* data, const CC_Mqtt311SessionStoreRecord* record);
+
+    std::string m_path;
+    boost::interprocess::file_mapping m_mapping;
+    boost::interprocess::mapped_region m_region;
+    std::size_t m_used = 0U;
+    EntriesList m_entries;
+    EntriesMap m_entriesMap;
+    DataBuf m_buf;
+};
+
+} // namespace cc_mqtt311_client_app
@@ -65,8 +65,16 @@ void TcpSession::sendDataImpl(const std::uint8_t* buf, std::size_t bufLen)
 
 void TcpSession::doRead()
 {
+    std::size_t len = 0U;
+    auto* buf = acquireInput(len);
+    if ((buf == nullptr) || (len == 0U)) {
+        logError() << "No space left in the input buffer." << std::endl;
+        reportNetworkDisconnected();
+        return;
+    }
+
     m_socket.async_read_some(
-        boost::asio::buffer(m_inData),
+        boost::asio::buffer(buf, len),
         [this](const boost::system::error_code& ec, std::size_t bytesCount)
         {
             if (ec == boost::asio::error::operation_aborted) {
@@ -79,33 +87,7 @@ void TcpSession::doRead()
                 return;
             }
 
-            auto buf = &m_inData[0];
-            auto bufLen = bytesCount;
-            if (!m_buf.empty()) {
-                m_buf.reserve(m_buf.size() + bytesCount);
-                m_buf.insert(m_buf.end(), m_inData.begin(), m_inData.begin() + bytesCount);
-                buf = &m_buf[0];
-                bufLen = m_buf.size();
-            }
-
-            auto consumed = reportData(buf, bufLen);
-            do {
-                if (bufLen <= consumed) {
-                    m_buf.clear();
-                    break;
-                }
-
-                if (!m_buf.empty()) {
-                    assert(buf == &m_buf[0]);
-                    m_buf.erase(m_buf.begin(), m_buf.begin() + consumed);
-                    break;
-                }
-
-                assert(buf == &m_inData[0]);
-                m_buf.reserve(m_buf.size() + (bytesCount - consumed));
-                m_buf.insert(m_buf.end(), m_inData.begin() + consumed, m_inData.begin() + bytesCount);
-            } while (false);
-
+            commitInput(bytesCount);
             doRead();
         }
     );
@@ -9,9 +9,7 @@
 
 #include "Session.h"
 
-#include <array>
 #include <cstdint>
-#include <vector>
 
 namespace cc_mqtt311_client_app
 {
@@ -28,8 +26,6 @@ protected:
 
 private:
     using Socket = boost::asio::ip::tcp::socket;
-    using InDataBuf = std::array<std::uint8_t, 4096>;
-    using DataBuf = std::vector<std::uint8_t>;
 
     TcpSession(boost::asio::io_context& io, const ProgramOptions& opts) : 
         Base(io, opts),
@@ -40,8 +36,6 @@ private:
     void doRead();
 
     Socket m_socket;
-    InDataBuf m_inData;
-    DataBuf m_buf;
 };
 
 } // namespace cc_mqtt311_client_app
@@ -13,9 +13,7 @@
 
 #include <boost/asio/ssl.hpp>
 
-#include <array>
 #include <cstdint>
-#include <vector>
 
 namespace cc_mqtt311_client_app
 {
@@ -33,8 +31,6 @@ protected:
 private:
     using SslContext = boost::asio::ssl::context;
     using Socket = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
-    using InDataBuf = std::array<std::uint8_t, 4096>;
-    using DataBuf = std::vector<std::uint8_t>;
 
     TlsSession(boost::asio::io_context& io, const ProgramOptions& opts);
     void doRead();
@@ -45,8 +41,6 @@ private:
 
     std::unique_ptr<SslContext> m_ctx;
     std::unique_ptr<Socket> m_socket;
-    InDataBuf m_inData;
-    DataBuf m_buf;
 };
 
 } // namespace cc_mqtt311_client_app
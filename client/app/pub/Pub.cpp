@@ -31,8 +31,54 @@ Pub::Pub(boost::asio::io_context& io, int& result) :
     opts().addTls();
     opts().addConnect();
     opts().addPublish();
+    opts().addMultiClient();
 }    
 
+bool Pub::startMultiClientImpl()
+{
+    m_poolReq.m_topic = opts().pubTopic();
+    m_poolReq.m_data = parseBinaryData(opts().pubMessage());
+    m_poolReq.m_qos = static_cast<CC_Mqtt311QoS>(opts().pubQos());
+    m_poolReq.m_retain = opts().pubRetain();
+
+    auto clientsCount = opts().clientsCount();
+    m_poolDone.assign(clientsCount, 0U);
+
+    m_pool = std::make_unique<ClientPool>(opts(), opts().threadsCount());
+    m_pool->setConnectedCb(
+        [this](unsigned clientIdx)
+        {
+            auto req = m_poolReq;
+            if (!m_pool->publish(clientIdx, std::move(req))) {
+                multiClientCompleteInternal(clientIdx, CC_Mqtt311AsyncOpStatus_Aborted);
+            }
+        });
+
+    m_pool->setDisconnectedCb(
+        [this](unsigned clientIdx)
+        {
+            // Failed connection or disconnection before the publish completion
+            multiClientCompleteInternal(clientIdx, CC_Mqtt311AsyncOpStatus_BrokerDisconnected);
+        });
+
+    m_pool->setPublishCompleteCb(
+        [this](unsigned clientIdx, CC_Mqtt311AsyncOpStatus status)
+        {
+            multiClientCompleteInternal(clientIdx, status);
+        });
+
+    if (!m_pool->start(clientsCount)) {
+        logError() << "Failed to start " << clientsCount << " clients." << std::endl;
+        return false;
+    }
+
+    if (opts().verbose()) {
+        std::cout << "Publishing via " << clientsCount << " clients driven by " << m_pool->threadsCount() << " threads" << std::endl;
+    }
+
+    return true;
+}
+
 void Pub::brokerConnectedImpl()
 {
     auto topic = opts().pubTopic();
@@ -68,6 +114,46 @@ void Pub::publishCompleteInternal([[maybe_unused]] CC_Mqtt311PublishHandle handl
     doTerminate(0);
 }
 
+void Pub::multiClientCompleteInternal(unsigned clientIdx, CC_Mqtt311AsyncOpStatus status)
+{
+    // Invoked on the thread of the worker owning the client
+    auto& done = m_poolDone[clientIdx];
+    if (done != 0U) {
+        return;
+    }
+
+    done = 1U;
+    if (status != CC_Mqtt311AsyncOpStatus_Complete) {
+        ++m_poolFailed;
+    }
+
+    if ((++m_poolCompleted) < m_poolDone.size()) {
+        return;
+    }
+
+    boost::asio::post(
+        io(),
+        [this]()
+        {
+            multiClientFinalize();
+        });
+}
+
+void Pub::multiClientFinalize()
+{
+    m_pool->stop();
+
+    auto failed = m_poolFailed.load();
+    if (failed > 0U) {
+        logError() << failed << " out of " << m_poolDone.size() << " publishes failed" << std::endl;
+        doTerminate();
+        return;
+    }
+
+    std::cout << "Publish successful" << std::endl;
+    doTerminate(0);
+}
+
 void Pub::publishCompleteCb(void* data, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status)
 {
     asThis(data)->publishCompleteInternal(handle, status);
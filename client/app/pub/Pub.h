@@ -8,10 +8,16 @@
 #pragma once
 
 #include "AppClient.h"
+#include "ClientPool.h"
 #include "ProgramOptions.h"
 
 #include <boost/asio.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace cc_mqtt311_client_app
 {
 
@@ -22,11 +28,20 @@ public:
     Pub(boost::asio::io_context& io, int& result);
 
 protected:
+    virtual bool startMultiClientImpl() override;
     virtual void brokerConnectedImpl() override;    
 private:
     void publishCompleteInternal(CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
+    void multiClientCompleteInternal(unsigned clientIdx, CC_Mqtt311AsyncOpStatus status);
+    void multiClientFinalize();
 
     static void publishCompleteCb(void* data, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
+
+    ClientPool::PublishRequest m_poolReq;
+    std::vector<std::uint8_t> m_poolDone; // Every element is accessed only by the thread owning the client
+    std::atomic<unsigned> m_poolCompleted{0U};
+    std::atomic<unsigned> m_poolFailed{0U};
+    std::unique_ptr<ClientPool> m_pool; // Destructed first, stops the worker threads
 };
 
 } // namespace cc_mqtt311_client_app
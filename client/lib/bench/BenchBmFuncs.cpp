@@ -0,0 +1,47 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include "bm_client.h"
+
+const BenchFuncs& benchFuncs()
+{
+    static BenchFuncs funcs;
+    funcs.m_alloc = &cc_mqtt311_bm_client_alloc;
+    funcs.m_free = &cc_mqtt311_bm_client_free;
+    funcs.m_tick = &cc_mqtt311_bm_client_tick;
+    funcs.m_process_data = &cc_mqtt311_bm_client_process_data;
+    funcs.m_set_default_response_timeout = &cc_mqtt311_bm_client_set_default_response_timeout;
+    funcs.m_set_verify_outgoing_topic_enabled = &cc_mqtt311_bm_client_set_verify_outgoing_topic_enabled;
+    funcs.m_set_verify_incoming_msg_subscribed = &cc_mqtt311_bm_client_set_verify_incoming_msg_subscribed;
+    funcs.m_set_lazy_publish_decode = &cc_mqtt311_bm_client_set_lazy_publish_decode;
+    funcs.m_connect_init_config = &cc_mqtt311_bm_client_connect_init_config;
+    funcs.m_connect = &cc_mqtt311_bm_client_connect;
+    funcs.m_is_connected = &cc_mqtt311_bm_client_is_connected;
+    funcs.m_subscribe_prepare = &cc_mqtt311_bm_client_subscribe_prepare;
+    funcs.m_subscribe_init_config_topic = &cc_mqtt311_bm_client_subscribe_init_config_topic;
+    funcs.m_subscribe_config_topic = &cc_mqtt311_bm_client_subscribe_config_topic;
+    funcs.m_subscribe_cancel = &cc_mqtt311_bm_client_subscribe_cancel;
+    funcs.m_subscribe = &cc_mqtt311_bm_client_subscribe;
+    funcs.m_publish_prepare = &cc_mqtt311_bm_client_publish_prepare;
+    funcs.m_publish_init_config = &cc_mqtt311_bm_client_publish_init_config;
+    funcs.m_publish_config = &cc_mqtt311_bm_client_publish_config;
+    funcs.m_publish_cancel = &cc_mqtt311_bm_client_publish_cancel;
+    funcs.m_publish = &cc_mqtt311_bm_client_publish;
+    funcs.m_set_next_tick_program_callback = &cc_mqtt311_bm_client_set_next_tick_program_callback;
+    funcs.m_set_cancel_next_tick_wait_callback = &cc_mqtt311_bm_client_set_cancel_next_tick_wait_callback;
+    funcs.m_set_send_output_data_callback = &cc_mqtt311_bm_client_set_send_output_data_callback;
+    funcs.m_set_broker_disconnect_report_callback = &cc_mqtt311_bm_client_set_broker_disconnect_report_callback;
+    funcs.m_set_message_received_report_callback = &cc_mqtt311_bm_client_set_message_received_report_callback;
+    return funcs;
+}
+
+const char* benchConfigName()
+{
+    return "bm";
+}
@@ -0,0 +1,237 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+void appendRemLen(BenchDataBuf& buf, std::size_t remLen)
+{
+    do {
+        auto byte = static_cast<std::uint8_t>(remLen & 0x7f);
+        remLen >>= 7U;
+        if (remLen > 0U) {
+            byte |= 0x80;
+        }
+        buf.push_back(byte);
+    } while (remLen > 0U);
+}
+
+void appendU16(BenchDataBuf& buf, std::size_t value)
+{
+    buf.push_back(static_cast<std::uint8_t>(value >> 8U));
+    buf.push_back(static_cast<std::uint8_t>(value));
+}
+
+} // namespace
+
+BenchDataBuf benchMakePublish(const std::string& topic, std::size_t payloadLen, CC_Mqtt311QoS qos, std::uint16_t packetId)
+{
+    bool hasPacketId = (qos > CC_Mqtt311QoS_AtMostOnceDelivery);
+    auto remLen = 2U + topic.size() + payloadLen;
+    if (hasPacketId) {
+        remLen += 2U;
+    }
+
+    BenchDataBuf buf;
+    buf.reserve(remLen + 8U);
+    buf.push_back(static_cast<std::uint8_t>(BenchPacketType_Publish | (static_cast<unsigned>(qos) << 1U)));
+    appendRemLen(buf, remLen);
+    appendU16(buf, topic.size());
+    buf.insert(buf.end(), topic.begin(), topic.end());
+    if (hasPacketId) {
+        appendU16(buf, packetId);
+    }
+
+    buf.resize(buf.size() + payloadLen, 0xab);
+    return buf;
+}
+
+BenchDataBuf benchMakeAck(BenchPacketType type, std::uint16_t packetId)
+{
+    BenchDataBuf buf;
+    buf.push_back(type);
+    appendRemLen(buf, 2U);
+    appendU16(buf, packetId);
+    return buf;
+}
+
+BenchDataBuf benchMakeSuback(std::uint16_t packetId, CC_Mqtt311QoS qos)
+{
+    BenchDataBuf buf;
+    buf.push_back(BenchPacketType_Suback);
+    appendRemLen(buf, 3U);
+    appendU16(buf, packetId);
+    buf.push_back(static_cast<std::uint8_t>(qos));
+    return buf;
+}
+
+BenchDataBuf benchMakePingresp()
+{
+    return BenchDataBuf{BenchPacketType_Pingresp, 0x00};
+}
+
+BenchClient::BenchClient() :
+    m_funcs(benchFuncs()),
+    m_client(m_funcs.m_alloc())
+{
+    if (m_client == nullptr) {
+        return;
+    }
+
+    m_funcs.m_set_send_output_data_callback(m_client, &BenchClient::sendOutputDataCb, this);
+    m_funcs.m_set_broker_disconnect_report_callback(m_client, &BenchClient::brokerDisconnectReportCb, this);
+    m_funcs.m_set_message_received_report_callback(m_client, &BenchClient::messageReceivedReportCb, this);
+    m_funcs.m_set_next_tick_program_callback(m_client, &BenchClient::nextTickProgramCb, this);
+    m_funcs.m_set_cancel_next_tick_wait_callback(m_client, &BenchClient::cancelNextTickWaitCb, this);
+}
+
+BenchClient::~BenchClient()
+{
+    if (m_client != nullptr) {
+        m_funcs.m_free(m_client);
+    }
+}
+
+bool BenchClient::connect()
+{
+    if (m_client == nullptr) {
+        return false;
+    }
+
+    auto config = CC_Mqtt311ConnectConfig();
+    m_funcs.m_connect_init_config(&config);
+    config.m_clientId = "bench";
+    config.m_cleanSession = true;
+    auto ec = m_funcs.m_connect(m_client, &config, nullptr, &BenchClient::connectCompleteCb, this);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        return false;
+    }
+
+    processData(BenchDataBuf{BenchPacketType_Connack, 0x02, 0x00, 0x00});
+    return m_funcs.m_is_connected(m_client);
+}
+
+bool BenchClient::publish(const std::string& topic, const BenchDataBuf& data, CC_Mqtt311QoS qos)
+{
+    auto config = CC_Mqtt311PublishConfig();
+    m_funcs.m_publish_init_config(&config);
+    config.m_topic = topic.c_str();
+    config.m_data = data.data();
+    config.m_dataLen = static_cast<unsigned>(data.size());
+    config.m_qos = qos;
+    auto ec = m_funcs.m_publish(m_client, &config, &BenchClient::publishCompleteCb, this);
+    return ec == CC_Mqtt311ErrorCode_Success;
+}
+
+bool BenchClient::subscribe(const std::string& filter)
+{
+    auto config = CC_Mqtt311SubscribeTopicConfig();
+    m_funcs.m_subscribe_init_config_topic(&config);
+    config.m_topic = filter.c_str();
+    config.m_maxQos = CC_Mqtt311QoS_AtMostOnceDelivery;
+    auto ec = m_funcs.m_subscribe(m_client, &config, 1U, &BenchClient::subscribeCompleteCb, this);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        return false;
+    }
+
+    auto completed = m_completedCount;
+    processData(benchMakeSuback(m_lastSentPacketId, config.m_maxQos));
+    return completed < m_completedCount;
+}
+
+void BenchClient::sendOutputDataCb(void* data, const unsigned char* buf, unsigned bufLen)
+{
+    auto* thisPtr = static_cast<BenchClient*>(data);
+    thisPtr->m_sentBytes += bufLen;
+    thisPtr->m_lastSentType = static_cast<std::uint8_t>(buf[0] & 0xf0);
+
+    // Skip the fixed header
+    unsigned pos = 1U;
+    while ((pos < bufLen) && ((buf[pos] & 0x80) != 0U)) {
+        ++pos;
+    }
+    ++pos;
+
+    switch (thisPtr->m_lastSentType) {
+        case BenchPacketType_Publish: {
+            if ((buf[0] & 0x06) == 0U) {
+                return; // QoS0, no packet ID
+            }
+
+            if (bufLen < (pos + 2U)) {
+                return;
+            }
+
+            pos += 2U + ((static_cast<unsigned>(buf[pos]) << 8U) | buf[pos + 1U]);
+            break;
+        }
+        case BenchPacketType_Pubrel & 0xf0:
+        case 0x80: // SUBSCRIBE
+        case 0xa0: // UNSUBSCRIBE
+            break;
+        default:
+            return;
+    }
+
+    if (bufLen < (pos + 2U)) {
+        return;
+    }
+
+    thisPtr->m_lastSentPacketId = static_cast<std::uint16_t>((static_cast<unsigned>(buf[pos]) << 8U) | buf[pos + 1U]);
+}
+
+void BenchClient::brokerDisconnectReportCb(void* data, [[maybe_unused]] CC_Mqtt311BrokerDisconnectReason reason)
+{
+    static_cast<BenchClient*>(data)->m_disconnected = true;
+}
+
+void BenchClient::messageReceivedReportCb(void* data, const CC_Mqtt311MessageInfo* info)
+{
+    benchmark::DoNotOptimize(info->m_data);
+    ++static_cast<BenchClient*>(data)->m_receivedCount;
+}
+
+void BenchClient::nextTickProgramCb(void* data, [[maybe_unused]] unsigned duration)
+{
+    static_cast<BenchClient*>(data)->m_tickProgrammed = true;
+}
+
+unsigned BenchClient::cancelNextTickWaitCb(void* data)
+{
+    // No time elapses between the API calls
+    static_cast<BenchClient*>(data)->m_tickProgrammed = false;
+    return 0U;
+}
+
+void BenchClient::connectCompleteCb(
+    [[maybe_unused]] void* data,
+    [[maybe_unused]] CC_Mqtt311AsyncOpStatus status,
+    [[maybe_unused]] const CC_Mqtt311ConnectResponse* response)
+{
+}
+
+void BenchClient::subscribeCompleteCb(
+    void* data,
+    [[maybe_unused]] CC_Mqtt311SubscribeHandle handle,
+    CC_Mqtt311AsyncOpStatus status,
+    [[maybe_unused]] const CC_Mqtt311SubscribeResponse* response)
+{
+    if (status == CC_Mqtt311AsyncOpStatus_Complete) {
+        ++static_cast<BenchClient*>(data)->m_completedCount;
+    }
+}
+
+void BenchClient::publishCompleteCb(void* data, [[maybe_unused]] CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status)
+{
+    if (status == CC_Mqtt311AsyncOpStatus_Complete) {
+        ++static_cast<BenchClient*>(data)->m_completedCount;
+    }
+}
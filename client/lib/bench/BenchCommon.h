@@ -0,0 +1,160 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "cc_mqtt311_client/common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The same benchmarks are built against every available client library
+// configuration, the configuration specific API is accessed via this table.
+struct BenchFuncs
+{
+    CC_Mqtt311ClientHandle (*m_alloc)() = nullptr;
+    void (*m_free)(CC_Mqtt311ClientHandle) = nullptr;
+    void (*m_tick)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+    unsigned (*m_process_data)(CC_Mqtt311ClientHandle, const unsigned char*, unsigned) = nullptr;
+    CC_Mqtt311ErrorCode (*m_set_default_response_timeout)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+    CC_Mqtt311ErrorCode (*m_set_verify_outgoing_topic_enabled)(CC_Mqtt311ClientHandle, bool) = nullptr;
+    CC_Mqtt311ErrorCode (*m_set_verify_incoming_msg_subscribed)(CC_Mqtt311ClientHandle, bool) = nullptr;
+    CC_Mqtt311ErrorCode (*m_set_lazy_publish_decode)(CC_Mqtt311ClientHandle, bool) = nullptr;
+    void (*m_connect_init_config)(CC_Mqtt311ConnectConfig*) = nullptr;
+    CC_Mqtt311ErrorCode (*m_connect)(CC_Mqtt311ClientHandle, const CC_Mqtt311ConnectConfig*, const CC_Mqtt311ConnectWillConfig*, CC_Mqtt311ConnectCompleteCb, void*) = nullptr;
+    bool (*m_is_connected)(CC_Mqtt311ClientHandle) = nullptr;
+    CC_Mqtt311SubscribeHandle (*m_subscribe_prepare)(CC_Mqtt311ClientHandle, CC_Mqtt311ErrorCode*) = nullptr;
+    void (*m_subscribe_init_config_topic)(CC_Mqtt311SubscribeTopicConfig*) = nullptr;
+    CC_Mqtt311ErrorCode (*m_subscribe_config_topic)(CC_Mqtt311SubscribeHandle, const CC_Mqtt311SubscribeTopicConfig*) = nullptr;
+    CC_Mqtt311ErrorCode (*m_subscribe_cancel)(CC_Mqtt311SubscribeHandle) = nullptr;
+    CC_Mqtt311ErrorCode (*m_subscribe)(CC_Mqtt311ClientHandle, const CC_Mqtt311SubscribeTopicConfig*, unsigned, CC_Mqtt311SubscribeCompleteCb, void*) = nullptr;
+    CC_Mqtt311PublishHandle (*m_publish_prepare)(CC_Mqtt311ClientHandle, CC_Mqtt311ErrorCode*) = nullptr;
+    void (*m_publish_init_config)(CC_Mqtt311PublishConfig*) = nullptr;
+    CC_Mqtt311ErrorCode (*m_publish_config)(CC_Mqtt311PublishHandle, const CC_Mqtt311PublishConfig*) = nullptr;
+    CC_Mqtt311ErrorCode (*m_publish_cancel)(CC_Mqtt311PublishHandle) = nullptr;
+    CC_Mqtt311ErrorCode (*m_publish)(CC_Mqtt311ClientHandle, const CC_Mqtt311PublishConfig*, CC_Mqtt311PublishCompleteCb, void*) = nullptr;
+    void (*m_set_next_tick_program_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311NextTickProgramCb, void*) = nullptr;
+    void (*m_set_cancel_next_tick_wait_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311CancelNextTickWaitCb, void*) = nullptr;
+    void (*m_set_send_output_data_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311SendOutputDataCb, void*) = nullptr;
+    void (*m_set_broker_disconnect_report_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311BrokerDisconnectReportCb, void*) = nullptr;
+    void (*m_set_message_received_report_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311MessageReceivedReportCb, void*) = nullptr;
+};
+
+// Implemented by the configuration specific source
+const BenchFuncs& benchFuncs();
+const char* benchConfigName();
+
+using BenchDataBuf = std::vector<std::uint8_t>;
+
+// Fixed header types of the packets injected as if sent by the broker
+enum BenchPacketType : std::uint8_t
+{
+    BenchPacketType_Connack = 0x20,
+    BenchPacketType_Publish = 0x30,
+    BenchPacketType_Puback = 0x40,
+    BenchPacketType_Pubrec = 0x50,
+    BenchPacketType_Pubrel = 0x62,
+    BenchPacketType_Pubcomp = 0x70,
+    BenchPacketType_Suback = 0x90,
+    BenchPacketType_Pingresp = 0xd0,
+};
+
+BenchDataBuf benchMakePublish(const std::string& topic, std::size_t payloadLen, CC_Mqtt311QoS qos = CC_Mqtt311QoS_AtMostOnceDelivery, std::uint16_t packetId = 0U);
+BenchDataBuf benchMakeAck(BenchPacketType type, std::uint16_t packetId);
+BenchDataBuf benchMakeSuback(std::uint16_t packetId, CC_Mqtt311QoS qos);
+BenchDataBuf benchMakePingresp();
+
+// Connected client with all the callbacks recording the activity,
+// the broker is emulated by injecting the raw packets.
+class BenchClient
+{
+public:
+    BenchClient();
+    ~BenchClient();
+
+    BenchClient(const BenchClient&) = delete;
+    BenchClient& operator=(const BenchClient&) = delete;
+
+    bool connect();
+
+    CC_Mqtt311ClientHandle handle() const
+    {
+        return m_client;
+    }
+
+    const BenchFuncs& funcs() const
+    {
+        return m_funcs;
+    }
+
+    unsigned processData(const BenchDataBuf& buf)
+    {
+        return m_funcs.m_process_data(m_client, buf.data(), static_cast<unsigned>(buf.size()));
+    }
+
+    bool publish(const std::string& topic, const BenchDataBuf& data, CC_Mqtt311QoS qos);
+
+    // Completes the subscription
+    bool subscribe(const std::string& filter);
+
+    bool isDisconnected() const
+    {
+        return m_disconnected;
+    }
+
+    bool isTickProgrammed() const
+    {
+        return m_tickProgrammed;
+    }
+
+    std::size_t receivedCount() const
+    {
+        return m_receivedCount;
+    }
+
+    std::size_t completedCount() const
+    {
+        return m_completedCount;
+    }
+
+    std::size_t sentBytes() const
+    {
+        return m_sentBytes;
+    }
+
+    std::uint8_t lastSentType() const
+    {
+        return m_lastSentType;
+    }
+
+    std::uint16_t lastSentPacketId() const
+    {
+        return m_lastSentPacketId;
+    }
+
+private:
+    static void sendOutputDataCb(void* data, const unsigned char* buf, unsigned bufLen);
+    static void brokerDisconnectReportCb(void* data, CC_Mqtt311BrokerDisconnectReason reason);
+    static void messageReceivedReportCb(void* data, const CC_Mqtt311MessageInfo* info);
+    static void nextTickProgramCb(void* data, unsigned duration);
+    static unsigned cancelNextTickWaitCb(void* data);
+    static void connectCompleteCb(void* data, CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311ConnectResponse* response);
+    static void subscribeCompleteCb(void* data, CC_Mqtt311SubscribeHandle handle, CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311SubscribeResponse* response);
+    static void publishCompleteCb(void* data, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
+
+    const BenchFuncs& m_funcs;
+    CC_Mqtt311ClientHandle m_client = nullptr;
+    std::size_t m_receivedCount = 0U;
+    std::size_t m_completedCount = 0U;
+    std::size_t m_sentBytes = 0U;
+    std::uint16_t m_lastSentPacketId = 0U;
+    std::uint8_t m_lastSentType = 0U;
+    bool m_disconnected = false;
+    bool m_tickProgrammed = false;
+};
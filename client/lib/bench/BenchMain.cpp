@@ -0,0 +1,23 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+    // Recorded in the "context" of the JSON output to distinguish the results
+    benchmark::AddCustomContext("client_config", benchConfigName());
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,152 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace
+{
+
+const std::string Topic("bench/receive/topic");
+
+bool prepareReceiver(benchmark::State& state, BenchClient& client)
+{
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return false;
+    }
+
+    client.funcs().m_set_verify_incoming_msg_subscribed(client.handle(), false);
+    return true;
+}
+
+bool checkReceived(benchmark::State& state, const BenchClient& client, std::size_t expected)
+{
+    if (client.isDisconnected()) {
+        state.SkipWithMessage("Message is not accepted by the configuration");
+        return false;
+    }
+
+    if (client.receivedCount() < expected) {
+        state.SkipWithError("Message is not reported");
+        return false;
+    }
+
+    return true;
+}
+
+void benchProcessPublish(benchmark::State& state, CC_Mqtt311QoS qos)
+{
+    BenchClient client;
+    if (!prepareReceiver(state, client)) {
+        return;
+    }
+
+    static const std::uint16_t PacketId = 1U;
+    auto packet = benchMakePublish(Topic, static_cast<std::size_t>(state.range(0)), qos, PacketId);
+
+    // The QoS2 reception is reported only after the PUBREL
+    BenchDataBuf pubrel;
+    if (qos == CC_Mqtt311QoS_ExactlyOnceDelivery) {
+        pubrel = benchMakeAck(BenchPacketType_Pubrel, PacketId);
+    }
+
+    for (auto _ : state) {
+        client.processData(packet);
+        if (!pubrel.empty()) {
+            client.processData(pubrel);
+        }
+    }
+
+    if (!checkReceived(state, client, static_cast<std::size_t>(state.iterations()))) {
+        return;
+    }
+
+    auto bytes = packet.size() + pubrel.size();
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(bytes));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void BM_ProcessPublishQos0(benchmark::State& state)
+{
+    benchProcessPublish(state, CC_Mqtt311QoS_AtMostOnceDelivery);
+}
+
+void BM_ProcessPublishQos1(benchmark::State& state)
+{
+    benchProcessPublish(state, CC_Mqtt311QoS_AtLeastOnceDelivery);
+}
+
+void BM_ProcessPublishQos2(benchmark::State& state)
+{
+    benchProcessPublish(state, CC_Mqtt311QoS_ExactlyOnceDelivery);
+}
+
+// Many small messages delivered by a single read from the socket
+void BM_ProcessPublishBatch(benchmark::State& state)
+{
+    BenchClient client;
+    if (!prepareReceiver(state, client)) {
+        return;
+    }
+
+    auto count = static_cast<std::size_t>(state.range(0));
+    auto packet = benchMakePublish(Topic, 16U);
+    BenchDataBuf batch;
+    batch.reserve(packet.size() * count);
+    for (auto idx = 0U; idx < count; ++idx) {
+        batch.insert(batch.end(), packet.begin(), packet.end());
+    }
+
+    for (auto _ : state) {
+        auto consumed = client.processData(batch);
+        benchmark::DoNotOptimize(consumed);
+    }
+
+    auto total = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count);
+    if (!checkReceived(state, client, static_cast<std::size_t>(total))) {
+        return;
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(batch.size()));
+    state.SetItemsProcessed(total);
+}
+
+// Minimal message, the framing and dispatch overhead only
+void BM_ProcessPingresp(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto packet = benchMakePingresp();
+    for (auto _ : state) {
+        auto consumed = client.processData(packet);
+        benchmark::DoNotOptimize(consumed);
+    }
+
+    if (client.isDisconnected()) {
+        state.SkipWithError("Unexpected disconnection");
+        return;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ProcessPublishQos0)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ProcessPublishQos1)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ProcessPublishQos2)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ProcessPublishBatch)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_ProcessPingresp);
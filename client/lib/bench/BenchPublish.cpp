@@ -0,0 +1,129 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const std::string Topic("bench/publish/topic");
+
+// Publish and complete the whole exchange with the emulated broker
+void benchPublish(benchmark::State& state, CC_Mqtt311QoS qos)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    BenchDataBuf payload(static_cast<std::size_t>(state.range(0)), 0xab);
+    for (auto _ : state) {
+        if (!client.publish(Topic, payload, qos)) {
+            state.SkipWithMessage("Publish is not accepted by the configuration");
+            break;
+        }
+
+        if (qos == CC_Mqtt311QoS_AtLeastOnceDelivery) {
+            client.processData(benchMakeAck(BenchPacketType_Puback, client.lastSentPacketId()));
+        }
+        else if (qos == CC_Mqtt311QoS_ExactlyOnceDelivery) {
+            client.processData(benchMakeAck(BenchPacketType_Pubrec, client.lastSentPacketId()));
+            client.processData(benchMakeAck(BenchPacketType_Pubcomp, client.lastSentPacketId()));
+        }
+    }
+
+    if (state.skipped()) {
+        return;
+    }
+
+    if (client.isDisconnected() || (client.completedCount() < static_cast<std::size_t>(state.iterations()))) {
+        state.SkipWithError("Publish is not completed");
+        return;
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(client.sentBytes()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void BM_PublishQos0(benchmark::State& state)
+{
+    benchPublish(state, CC_Mqtt311QoS_AtMostOnceDelivery);
+}
+
+void BM_PublishQos1(benchmark::State& state)
+{
+    benchPublish(state, CC_Mqtt311QoS_AtLeastOnceDelivery);
+}
+
+void BM_PublishQos2(benchmark::State& state)
+{
+    benchPublish(state, CC_Mqtt311QoS_ExactlyOnceDelivery);
+}
+
+// Several publishes waiting for the acknowledgement at the same time,
+// dominated by the packet ID allocation and the in-flight ops lookup.
+void BM_PublishInflightQos1(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint16_t> packetIds;
+    packetIds.reserve(count);
+    BenchDataBuf payload(16U, 0xab);
+
+    for (auto _ : state) {
+        packetIds.clear();
+        for (auto idx = 0U; idx < count; ++idx) {
+            auto sentBytes = client.sentBytes();
+            if ((!client.publish(Topic, payload, CC_Mqtt311QoS_AtLeastOnceDelivery)) ||
+                (sentBytes == client.sentBytes())) {
+                break;
+            }
+
+            packetIds.push_back(client.lastSentPacketId());
+        }
+
+        if (packetIds.size() < count) {
+            state.SkipWithMessage("Too many publishes in flight for the configuration");
+            break;
+        }
+
+        for (auto packetId : packetIds) {
+            client.processData(benchMakeAck(BenchPacketType_Puback, packetId));
+        }
+    }
+
+    if (state.skipped()) {
+        return;
+    }
+
+    auto total = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count);
+    if (client.isDisconnected() || (client.completedCount() < static_cast<std::size_t>(total))) {
+        state.SkipWithError("Publish is not completed");
+        return;
+    }
+
+    state.SetItemsProcessed(total);
+}
+
+} // namespace
+
+BENCHMARK(BM_PublishQos0)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_PublishQos1)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_PublishQos2)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_PublishInflightQos1)->RangeMultiplier(2)->Range(1, 64);
@@ -0,0 +1,88 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace
+{
+
+void messageReceivedReportCb(void* data, const CC_Mqtt311MessageInfo* info)
+{
+    // Typical subscriber dropping the message based on the topic only
+    auto* count = reinterpret_cast<std::size_t*>(data);
+    if (info->m_topic[0] == 'x') {
+        return;
+    }
+
+    benchmark::DoNotOptimize(info->m_data);
+    ++(*count);
+}
+
+void benchReceivePublish(benchmark::State& state, bool lazy, const std::string& topic)
+{
+    std::size_t count = 0U;
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto& funcs = client.funcs();
+    funcs.m_set_message_received_report_callback(client.handle(), &messageReceivedReportCb, &count);
+    funcs.m_set_verify_incoming_msg_subscribed(client.handle(), false);
+    if (funcs.m_set_lazy_publish_decode(client.handle(), lazy) != CC_Mqtt311ErrorCode_Success) {
+        state.SkipWithMessage("Lazy decode is not supported");
+        return;
+    }
+
+    auto packet = benchMakePublish(topic, static_cast<std::size_t>(state.range(0)));
+    unsigned consumed = 0U;
+    for (auto _ : state) {
+        consumed = client.processData(packet);
+        benchmark::DoNotOptimize(consumed);
+    }
+
+    if (client.isDisconnected() || (consumed != packet.size())) {
+        state.SkipWithMessage("Message is not accepted by the configuration");
+        return;
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(packet.size()));
+    state.counters["reported"] = static_cast<double>(count);
+}
+
+void BM_ReceivePublishEager(benchmark::State& state)
+{
+    benchReceivePublish(state, false, "some/topic");
+}
+
+void BM_ReceivePublishLazy(benchmark::State& state)
+{
+    benchReceivePublish(state, true, "some/topic");
+}
+
+void BM_ReceivePublishEagerDropped(benchmark::State& state)
+{
+    benchReceivePublish(state, false, "xsome/topic");
+}
+
+void BM_ReceivePublishLazyDropped(benchmark::State& state)
+{
+    benchReceivePublish(state, true, "xsome/topic");
+}
+
+} // namespace
+
+BENCHMARK(BM_ReceivePublishEager)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ReceivePublishLazy)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ReceivePublishEagerDropped)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ReceivePublishLazyDropped)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,80 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace
+{
+
+// Every publish waiting for the acknowledgement holds the response timer,
+// ticking with 0 elapsed time walks the timers without expiring any of them.
+void BM_TimerTick(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto& funcs = client.funcs();
+    funcs.m_set_default_response_timeout(client.handle(), 60U * 60U * 1000U);
+
+    auto count = static_cast<std::size_t>(state.range(0));
+    BenchDataBuf payload(16U, 0xab);
+    for (auto idx = 0U; idx < count; ++idx) {
+        if (!client.publish("bench/timer/topic", payload, CC_Mqtt311QoS_AtLeastOnceDelivery)) {
+            state.SkipWithMessage("Too many publishes in flight for the configuration");
+            return;
+        }
+    }
+
+    for (auto _ : state) {
+        funcs.m_tick(client.handle(), 0U);
+    }
+
+    if (client.isDisconnected()) {
+        state.SkipWithError("Unexpected disconnection");
+        return;
+    }
+
+    state.counters["timers"] = static_cast<double>(count + 1U); // Including keep alive
+}
+
+// Timer programming and cancellation on the public API entry and exit
+void BM_TimerApiReprogram(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto packet = benchMakePingresp();
+    for (auto _ : state) {
+        client.processData(packet);
+        if (!client.isTickProgrammed()) {
+            state.SkipWithError("Next tick is not programmed");
+            break;
+        }
+    }
+
+    if (state.skipped()) {
+        return;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_TimerTick)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(BM_TimerApiReprogram);
@@ -0,0 +1,124 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BenchCommon.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace
+{
+
+std::string makeTopic(std::size_t levels, const std::string& last)
+{
+    std::string result;
+    for (auto idx = 1U; idx < levels; ++idx) {
+        result += "level" + std::to_string(idx) + '/';
+    }
+
+    return result + last;
+}
+
+// The publish configuration is rejected on invalid topic, i.e. the
+// op is prepared, configured and cancelled without sending anything.
+void BM_TopicVerifyPublish(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto& funcs = client.funcs();
+    if (funcs.m_set_verify_outgoing_topic_enabled(client.handle(), true) != CC_Mqtt311ErrorCode_Success) {
+        state.SkipWithMessage("Topic verification is not supported");
+        return;
+    }
+
+    auto topic = makeTopic(static_cast<std::size_t>(state.range(0)), "topic");
+    auto config = CC_Mqtt311PublishConfig();
+    funcs.m_publish_init_config(&config);
+    config.m_topic = topic.c_str();
+
+    for (auto _ : state) {
+        auto handle = funcs.m_publish_prepare(client.handle(), nullptr);
+        auto ec = funcs.m_publish_config(handle, &config);
+        benchmark::DoNotOptimize(ec);
+        funcs.m_publish_cancel(handle);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void BM_TopicVerifySubscribe(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto& funcs = client.funcs();
+    auto filter = makeTopic(static_cast<std::size_t>(state.range(0)), "+/#");
+    auto config = CC_Mqtt311SubscribeTopicConfig();
+    funcs.m_subscribe_init_config_topic(&config);
+    config.m_topic = filter.c_str();
+
+    for (auto _ : state) {
+        auto handle = funcs.m_subscribe_prepare(client.handle(), nullptr);
+        auto ec = funcs.m_subscribe_config_topic(handle, &config);
+        benchmark::DoNotOptimize(ec);
+        funcs.m_subscribe_cancel(handle);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+// The incoming message is matched against all the subscribed filters,
+// the matching one is the last.
+void BM_TopicMatchSubscribed(benchmark::State& state)
+{
+    BenchClient client;
+    if (!client.connect()) {
+        state.SkipWithError("Failed to connect");
+        return;
+    }
+
+    auto& funcs = client.funcs();
+    if (funcs.m_set_verify_incoming_msg_subscribed(client.handle(), true) != CC_Mqtt311ErrorCode_Success) {
+        state.SkipWithMessage("Subscription verification is not supported");
+        return;
+    }
+
+    auto count = static_cast<std::size_t>(state.range(0));
+    for (auto idx = 0U; idx < count; ++idx) {
+        if (!client.subscribe("sensor/" + std::to_string(idx) + "/+/value")) {
+            state.SkipWithMessage("Too many subscriptions for the configuration");
+            return;
+        }
+    }
+
+    auto packet = benchMakePublish("sensor/" + std::to_string(count - 1U) + "/room/value", 16U);
+    for (auto _ : state) {
+        client.processData(packet);
+    }
+
+    if (client.isDisconnected() || (client.receivedCount() < static_cast<std::size_t>(state.iterations()))) {
+        state.SkipWithError("Message is not reported");
+        return;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_TopicVerifyPublish)->RangeMultiplier(4)->Range(1, 16);
+BENCHMARK(BM_TopicVerifySubscribe)->RangeMultiplier(4)->Range(1, 16);
+BENCHMARK(BM_TopicMatchSubscribed)->RangeMultiplier(4)->Range(1, 64);
@@ -68,6 +68,7 @@ typedef enum
     CC_Mqtt311ErrorCode_Disconnecting = 12, ///< The client is in "disconnecting" state, (re)connect is required in the next iteration loop.
     CC_Mqtt311ErrorCode_NetworkDisconnected = 13, ///< When network is disconnected issueing new ops is not accepted
     CC_Mqtt311ErrorCode_PreparationLocked = 14, ///< Another operation is being prepared, cannot create a new one without performing "send" or "cancel".
+    CC_Mqtt311ErrorCode_QueueFull = 15, ///< The offline publish queue is full and its drop policy rejects new messages.
     CC_Mqtt311ErrorCode_ValuesLimit ///< Limit for the values
 } CC_Mqtt311ErrorCode;
 
@@ -95,6 +96,17 @@ typedef enum
     CC_Mqtt311PublishOrdering_ValuesLimit ///< Limit for the values
 } CC_Mqtt311PublishOrdering;
 
+/// @brief Priority class of the outgoing publish.
+/// @details Used to choose which of the paused (queued) "publish" operations is sent first.
+/// @ingroup publish
+typedef enum
+{
+    CC_Mqtt311PublishPriority_Normal = 0, ///< Normal priority, default.
+    CC_Mqtt311PublishPriority_Low = 1, ///< Low priority, suitable for bulk data.
+    CC_Mqtt311PublishPriority_High = 2, ///< High priority, suitable for alarms.
+    CC_Mqtt311PublishPriority_ValuesLimit ///< Limit for the values
+} CC_Mqtt311PublishPriority;
+
 /// @brief Reason for reporting unsolicited broker disconnection
 /// @ingroup global
 typedef enum
@@ -128,6 +140,73 @@ typedef enum
     CC_Mqtt311SubscribeReturnCode_Failure = 0x80, ///< value <b>Failure</b>. 
 } CC_Mqtt311SubscribeReturnCode;
 
+/// @brief Type of the MQTT v3.1.1 control packet.
+/// @details Used to index the per packet type statistics, see @ref CC_Mqtt311ClientStats.
+/// @ingroup client
+typedef enum
+{
+    CC_Mqtt311PacketType_Connect = 1, ///< @b CONNECT packet.
+    CC_Mqtt311PacketType_Connack = 2, ///< @b CONNACK packet.
+    CC_Mqtt311PacketType_Publish = 3, ///< @b PUBLISH packet.
+    CC_Mqtt311PacketType_Puback = 4, ///< @b PUBACK packet.
+    CC_Mqtt311PacketType_Pubrec = 5, ///< @b PUBREC packet.
+    CC_Mqtt311PacketType_Pubrel = 6, ///< @b PUBREL packet.
+    CC_Mqtt311PacketType_Pubcomp = 7, ///< @b PUBCOMP packet.
+    CC_Mqtt311PacketType_Subscribe = 8, ///< @b SUBSCRIBE packet.
+    CC_Mqtt311PacketType_Suback = 9, ///< @b SUBACK packet.
+    CC_Mqtt311PacketType_Unsubscribe = 10, ///< @b UNSUBSCRIBE packet.
+    CC_Mqtt311PacketType_Unsuback = 11, ///< @b UNSUBACK packet.
+    CC_Mqtt311PacketType_Pingreq = 12, ///< @b PINGREQ packet.
+    CC_Mqtt311PacketType_Pingresp = 13, ///< @b PINGRESP packet.
+    CC_Mqtt311PacketType_Disconnect = 14, ///< @b DISCONNECT packet.
+    CC_Mqtt311PacketType_ValuesLimit ///< Limit for the values
+} CC_Mqtt311PacketType;
+
+/// @brief Type of the measured latency.
+/// @see @ref CC_Mqtt311LatencyStats
+/// @ingroup client
+typedef enum
+{
+    CC_Mqtt311LatencyType_PublishQos0 = 0, ///< From the publish request to its completion for QoS0 messages.
+    CC_Mqtt311LatencyType_PublishQos1 = 1, ///< From the publish request to the reception of @b PUBACK.
+    CC_Mqtt311LatencyType_PublishQos2 = 2, ///< From the publish request to the reception of @b PUBCOMP.
+    CC_Mqtt311LatencyType_PublishToPubrec = 3, ///< From the publish request to the reception of @b PUBREC for QoS2 messages.
+    CC_Mqtt311LatencyType_PubrecToPubcomp = 4, ///< From the reception of @b PUBREC to the reception of @b PUBCOMP.
+    CC_Mqtt311LatencyType_ValuesLimit ///< Limit for the values
+} CC_Mqtt311LatencyType;
+
+/// @brief Tracing point of the library.
+/// @details Reported in the @ref CC_Mqtt311TraceRecord::m_event, the meaning of the
+///     @ref CC_Mqtt311TraceRecord::m_arg1 and @ref CC_Mqtt311TraceRecord::m_arg2 depends on the event.
+/// @ingroup client
+typedef enum
+{
+    CC_Mqtt311TraceEvent_ProcessDataEnter = 0, ///< Start of the incoming data processing, @b m_arg1 is the amount of reported bytes.
+    CC_Mqtt311TraceEvent_ProcessDataExit = 1, ///< End of the incoming data processing, @b m_arg1 is the amount of consumed bytes.
+    CC_Mqtt311TraceEvent_MsgDispatch = 2, ///< Dispatch of the received packet, @b m_arg1 is the @ref CC_Mqtt311PacketType, @b m_arg2 is the packet length.
+    CC_Mqtt311TraceEvent_MsgSent = 3, ///< Sending of the packet, @b m_arg1 is the @ref CC_Mqtt311PacketType, @b m_arg2 is the packet length.
+    CC_Mqtt311TraceEvent_OpCreate = 4, ///< Creation of the operation, @b m_arg1 is the @ref CC_Mqtt311TraceOpType.
+    CC_Mqtt311TraceEvent_OpComplete = 5, ///< Completion of the operation, @b m_arg1 is the @ref CC_Mqtt311TraceOpType.
+    CC_Mqtt311TraceEvent_TimerFire = 6, ///< Expiry of the timer, @b m_arg1 is the internal index of the timer.
+    CC_Mqtt311TraceEvent_ReconnectResend = 7, ///< Resend of the unacknowledged message after reconnection, @b m_arg1 is the packet identifier.
+    CC_Mqtt311TraceEvent_ValuesLimit ///< Limit for the values
+} CC_Mqtt311TraceEvent;
+
+/// @brief Kind of the operation reported by the @ref CC_Mqtt311TraceEvent_OpCreate
+///     and @ref CC_Mqtt311TraceEvent_OpComplete events.
+/// @ingroup client
+typedef enum
+{
+    CC_Mqtt311TraceOpType_Connect = 0, ///< "Connect" operation.
+    CC_Mqtt311TraceOpType_KeepAlive = 1, ///< Internal "keep alive" operation.
+    CC_Mqtt311TraceOpType_Disconnect = 2, ///< "Disconnect" operation.
+    CC_Mqtt311TraceOpType_Subscribe = 3, ///< "Subscribe" operation.
+    CC_Mqtt311TraceOpType_Unsubscribe = 4, ///< "Unsubscribe" operation.
+    CC_Mqtt311TraceOpType_Recv = 5, ///< Reception of the message from the broker.
+    CC_Mqtt311TraceOpType_Publish = 6, ///< "Publish" operation.
+    CC_Mqtt311TraceOpType_ValuesLimit ///< Limit for the values
+} CC_Mqtt311TraceOpType;
+
 /// @brief Declaration of the hidden structure used to define @ref CC_Mqtt311ClientHandle
 /// @ingroup client
 struct CC_Mqtt311Client;
@@ -137,6 +216,15 @@ struct CC_Mqtt311Client;
 /// @ingroup client
 typedef struct CC_Mqtt311Client* CC_Mqtt311ClientHandle;
 
+/// @brief Declaration of the hidden structure used to define @ref CC_Mqtt311ClientGroupHandle
+/// @ingroup client
+struct CC_Mqtt311ClientGroup;
+
+/// @brief Handle used to access group of clients driven by a single clock.
+/// @details Returned by cc_mqtt311_client_group_alloc() function.
+/// @ingroup client
+typedef struct CC_Mqtt311ClientGroup* CC_Mqtt311ClientGroupHandle;
+
 /// @brief Declaration of the hidden structure used to define @ref CC_Mqtt311ConnectHandle
 /// @ingroup connect
 struct CC_Mqtt311Connect;
@@ -249,8 +337,25 @@ typedef struct
     unsigned m_dataLen; ///< Amount of data bytes 
     CC_Mqtt311QoS m_qos; ///< QoS value used by the broker to report the message.
     bool m_retained; ///< Indication of whether the received message was "retained".
+    unsigned m_topicId; ///< Stable ID of the interned topic, 0 when not interned (see @b cc_mqtt311_client_set_topic_intern_limit()).
 } CC_Mqtt311MessageInfo;
 
+/// @brief Fragment of the received message reported in the streaming mode.
+/// @see @b cc_mqtt311_client_set_message_streaming_threshold()
+/// @ingroup global
+typedef struct
+{
+    const char* m_topic; ///< Topic used to publish the message
+    const unsigned char* m_data; ///< Pointer to the temporary buffer containing the fragment data, NULL when there is no data
+    unsigned m_dataLen; ///< Amount of data bytes in the fragment
+    unsigned m_offset; ///< Offset of the fragment within the message data
+    unsigned m_totalLen; ///< Total amount of the message data bytes
+    CC_Mqtt311QoS m_qos; ///< QoS value used by the broker to report the message.
+    bool m_retained; ///< Indication of whether the received message was "retained".
+    bool m_last; ///< Indication of the last fragment, the message is complete.
+    unsigned m_topicId; ///< Stable ID of the interned topic, 0 when not interned (see @b cc_mqtt311_client_set_topic_intern_limit()).
+} CC_Mqtt311MessageChunkInfo;
+
 /// @brief Configuration structure to be passed to the @b cc_mqtt311_client_publish_config().
 /// @see @b cc_mqtt311_client_publish_init_config()
 /// @ingroup publish
@@ -261,8 +366,184 @@ typedef struct
     unsigned m_dataLen; ///< Amount of bytes in the publish data buffer, defaults to 0.
     CC_Mqtt311QoS m_qos; ///< Publish QoS value, defaults to @ref CC_Mqtt311QoS_AtMostOnceDelivery.
     bool m_retain; ///< "Retain" flag, defaults to false.
+    CC_Mqtt311PublishPriority m_priority; ///< Priority class, defaults to @ref CC_Mqtt311PublishPriority_Normal.
 } CC_Mqtt311PublishConfig;
 
+/// @brief Statistics of the outgoing publishes of a single priority class.
+/// @see @b cc_mqtt311_client_publish_get_priority_stats()
+/// @ingroup publish
+typedef struct
+{
+    unsigned long long m_sentCount; ///< Total amount of sent (for the first time) @b PUBLISH messages.
+    unsigned long long m_completeCount; ///< Total amount of successfully completed "publish" operations.
+    unsigned m_pausedCount; ///< Current amount of paused (waiting to be sent) "publish" operations.
+} CC_Mqtt311PublishPriorityStats;
+
+/// @brief Configuration of the pacing of the in-flight messages resend after the session resumption.
+/// @see @b cc_mqtt311_client_publish_init_resend_pacing_config()
+/// @see @b cc_mqtt311_client_publish_set_resend_pacing()
+/// @ingroup publish
+typedef struct
+{
+    unsigned m_maxMsgs; ///< Maximal amount of messages resent in a single batch, 0 means no limit, defaults to 0.
+    unsigned m_maxBytes; ///< Maximal amount of serialized bytes resent in a single batch, 0 means no limit, defaults to 0.
+    unsigned m_intervalMs; ///< Delay in milliseconds between the batches, must be greater than 0, defaults to 100.
+} CC_Mqtt311ResendPacingConfig;
+
+/// @brief Policy of dropping messages when the offline publish queue is full.
+/// @see @ref CC_Mqtt311OfflineQueueConfig
+/// @ingroup publish
+typedef enum
+{
+    CC_Mqtt311OfflineQueueDropPolicy_Oldest = 0, ///< Drop the oldest queued message, default.
+    CC_Mqtt311OfflineQueueDropPolicy_Newest = 1, ///< Reject the message being queued.
+    CC_Mqtt311OfflineQueueDropPolicy_LowestQos = 2, ///< Drop the oldest queued message with the lowest QoS.
+    CC_Mqtt311OfflineQueueDropPolicy_ValuesLimit ///< Limit for the values
+} CC_Mqtt311OfflineQueueDropPolicy;
+
+/// @brief Configuration of the queue of the messages published while the client is disconnected.
+/// @see @b cc_mqtt311_client_publish_init_offline_queue_config()
+/// @see @b cc_mqtt311_client_publish_set_offline_queue()
+/// @ingroup publish
+typedef struct
+{
+    bool m_enabled; ///< Accept publishes while disconnected from the broker, defaults to false.
+    unsigned m_maxMsgs; ///< Maximal amount of queued messages, 0 means no limit, defaults to 0.
+    unsigned m_maxBytes; ///< Maximal amount of serialized bytes of queued messages, 0 means no limit, defaults to 0.
+    CC_Mqtt311OfflineQueueDropPolicy m_dropPolicy; ///< Policy to apply when the queue is full, defaults to @ref CC_Mqtt311OfflineQueueDropPolicy_Oldest.
+} CC_Mqtt311OfflineQueueConfig;
+
+/// @brief Type of the record reported to the session store.
+/// @see @ref CC_Mqtt311SessionStoreRecord
+/// @ingroup publish
+typedef enum
+{
+    CC_Mqtt311SessionStoreRecordType_Publish = 0, ///< QoS1 / QoS2 @b PUBLISH was sent for the first time and needs to be stored.
+    CC_Mqtt311SessionStoreRecordType_Pubrec = 1, ///< @b PUBREC was received for the stored QoS2 message, only @b PUBREL needs to be resent from now on.
+    CC_Mqtt311SessionStoreRecordType_Ack = 2, ///< The stored message was acknowledged (@b PUBACK or @b PUBCOMP received) and can be removed.
+    CC_Mqtt311SessionStoreRecordType_Discard = 3, ///< The stored message was discarded without acknowledgement (timeout, cancellation, session loss) and can be removed.
+    CC_Mqtt311SessionStoreRecordType_ValuesLimit ///< Limit for the values
+} CC_Mqtt311SessionStoreRecordType;
+
+/// @brief Record reported to the session store callback.
+/// @details The topic and data related members are populated only for the
+///     @ref CC_Mqtt311SessionStoreRecordType_Publish record type.
+/// @see @b cc_mqtt311_client_set_session_store_callback()
+/// @ingroup publish
+typedef struct
+{
+    CC_Mqtt311SessionStoreRecordType m_type; ///< Type of the record.
+    unsigned m_packetId; ///< Packet identifier of the stored message.
+    const char* m_topic; ///< Publish topic, NULL for non-publish records.
+    const unsigned char* m_data; ///< Pointer to publish data buffer, NULL when there is no data.
+    unsigned m_dataLen; ///< Amount of bytes in the publish data buffer.
+    CC_Mqtt311QoS m_qos; ///< Publish QoS value.
+    bool m_retain; ///< "Retain" flag.
+} CC_Mqtt311SessionStoreRecord;
+
+/// @brief Configuration structure to be passed to the @b cc_mqtt311_client_publish_restore().
+/// @see @b cc_mqtt311_client_publish_init_restore_config()
+/// @ingroup publish
+typedef struct
+{
+    CC_Mqtt311PublishConfig m_config; ///< Publish configuration, the QoS must be greater than 0.
+    unsigned m_packetId; ///< Packet identifier of the stored message, must be greater than 0.
+    bool m_pubrecReceived; ///< Whether @b PUBREC was received for the QoS2 message, defaults to false.
+} CC_Mqtt311PublishRestoreConfig;
+
+/// @brief Memory footprint of a single client, all the values are in bytes.
+/// @details The memory held by the user provided objects (such as topic and data
+///     buffers of the queued publishes) is not reported.
+/// @see @b cc_mqtt311_client_get_memory_footprint()
+/// @ingroup client
+typedef struct
+{
+    unsigned m_clientObj; ///< Size of the client object itself, includes all the statically allocated storage.
+    unsigned m_ops; ///< Dynamically allocated operation objects (keep alive, publish, subscribe, etc...).
+    unsigned m_opsLists; ///< Heap memory of the lists tracking the operations.
+    unsigned m_outputBuf; ///< Heap memory of the output buffer.
+    unsigned m_inputBuf; ///< Heap memory of the input buffer.
+    unsigned m_timers; ///< Heap memory of the timers storage.
+    unsigned m_memPool; ///< Chunks of the client owned memory pool, the pooled operations are part of this value.
+    unsigned m_topicIntern; ///< Heap memory of the topic interning table index.
+    unsigned m_publishQueue; ///< Heap memory of the thread-safe publish queue.
+    unsigned m_latencyStats; ///< Heap memory of the latency histograms.
+    unsigned m_traceRing; ///< Heap memory of the tracing records ring.
+    unsigned m_total; ///< Total of all the above.
+} CC_Mqtt311MemoryFootprint;
+
+/// @brief Configuration of the shrinking of the output buffer.
+/// @see @b cc_mqtt311_client_init_output_buf_shrink_config()
+/// @see @b cc_mqtt311_client_set_output_buf_shrink()
+/// @ingroup client
+typedef struct
+{
+    unsigned m_threshold; ///< Capacity in bytes the buffer is shrunk to when exceeded, 0 disables shrinking, defaults to 0.
+    unsigned m_decayMs; ///< Time in milliseconds since the last send exceeding the threshold before shrinking, defaults to 0.
+} CC_Mqtt311OutputBufShrinkConfig;
+
+/// @brief Largest values of the client resources usage.
+/// @see @b cc_mqtt311_client_get_high_water_marks()
+/// @ingroup client
+typedef struct
+{
+    unsigned m_outputBuf; ///< Largest amount of bytes serialized into the output buffer at once.
+    unsigned m_ops; ///< Largest amount of simultaneously existing operations of all types.
+    unsigned m_sendOps; ///< Largest amount of simultaneously existing "publish" operations.
+    unsigned m_recvOps; ///< Largest amount of simultaneously tracked incoming messages.
+    unsigned m_timers; ///< Largest amount of simultaneously allocated timers.
+} CC_Mqtt311HighWaterMarks;
+
+/// @brief Runtime statistics of the client.
+/// @details The per packet type arrays are indexed by the @ref CC_Mqtt311PacketType values.
+/// @see @b cc_mqtt311_client_get_stats()
+/// @ingroup client
+typedef struct
+{
+    unsigned long long m_packetsIn[CC_Mqtt311PacketType_ValuesLimit]; ///< Amount of received packets.
+    unsigned long long m_bytesIn[CC_Mqtt311PacketType_ValuesLimit]; ///< Amount of received bytes, including the fixed header.
+    unsigned long long m_packetsOut[CC_Mqtt311PacketType_ValuesLimit]; ///< Amount of sent packets.
+    unsigned long long m_bytesOut[CC_Mqtt311PacketType_ValuesLimit]; ///< Amount of sent bytes, including the fixed header.
+    unsigned long long m_dupResends; ///< Amount of resent @b PUBLISH (with @b DUP flag) and @b PUBREL packets.
+    unsigned long long m_timeouts; ///< Amount of expired waits for the broker response.
+    unsigned long long m_processDataCalls; ///< Amount of the incoming data processing invocations.
+    unsigned long long m_processDataBytes; ///< Amount of the incoming bytes consumed by the processing.
+    unsigned m_inflightSendOps; ///< Current amount of sent "publish" operations waiting for the acknowledgement.
+    unsigned m_inflightRecvOps; ///< Current amount of received messages waiting for the protocol exchange completion.
+    unsigned m_pausedSendOps; ///< Current amount of paused (waiting to be sent) "publish" operations.
+    unsigned m_allocatedPacketIds; ///< Current amount of allocated packet identifiers.
+    unsigned m_timers; ///< Current amount of allocated timers.
+} CC_Mqtt311ClientStats;
+
+/// @brief Latency statistics of a single @ref CC_Mqtt311LatencyType, all the times are in milliseconds.
+/// @details The percentiles are reported with the resolution of the histogram buckets,
+///     exact up to 16ms and within 12.5% of the measured value above it.
+/// @see @b cc_mqtt311_client_get_latency_stats()
+/// @ingroup client
+typedef struct
+{
+    unsigned m_count; ///< Amount of the recorded samples.
+    unsigned long long m_sumMs; ///< Sum of all the recorded samples.
+    unsigned m_minMs; ///< Lowest recorded sample.
+    unsigned m_maxMs; ///< Highest recorded sample.
+    unsigned m_p50Ms; ///< Median.
+    unsigned m_p90Ms; ///< 90th percentile.
+    unsigned m_p99Ms; ///< 99th percentile.
+    unsigned m_p999Ms; ///< 99.9th percentile.
+} CC_Mqtt311LatencyStats;
+
+/// @brief Single tracing record.
+/// @see @ref CC_Mqtt311TraceCb
+/// @see @b cc_mqtt311_client_trace_ring_read()
+/// @ingroup client
+typedef struct
+{
+    unsigned long long m_timestampMs; ///< Time reported to the library (see @b cc_mqtt311_client_tick()) since the client allocation.
+    CC_Mqtt311TraceEvent m_event; ///< Tracing point.
+    unsigned m_arg1; ///< First event specific argument.
+    unsigned m_arg2; ///< Second event specific argument.
+} CC_Mqtt311TraceRecord;
+
 /// @brief Callback used to request time measurement.
 /// @details The callback is set using
 ///     cc_mqtt311_client_set_next_tick_program_callback() function.
@@ -319,6 +600,80 @@ typedef void (*CC_Mqtt311MessageReceivedReportCb)(void* data, const CC_Mqtt311Me
 /// @ingroup client
 typedef void (*CC_Mqtt311ErrorLogCb)(void* data, const char* msg);
 
+/// @brief Callback used to report changes of the in-flight outgoing messages state.
+/// @details The callback is set using
+///     cc_mqtt311_client_set_session_store_callback() function. The reported records
+///     are expected to be appended to some persistent storage in order to
+///     be able to restore the in-flight messages using the cc_mqtt311_client_publish_restore()
+///     after the application restart.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_set_session_store_callback() function.
+/// @param[in] record Record information. Will NOT be NULL.
+/// @post The data members of the reported record can NOT be accessed after the function returns.
+/// @ingroup client
+typedef void (*CC_Mqtt311SessionStoreCb)(void* data, const CC_Mqtt311SessionStoreRecord* record);
+
+/// @brief Callback used to report fragments of the large received messages.
+/// @details The callback is set using
+///     cc_mqtt311_client_set_message_chunk_report_callback() function.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_set_message_chunk_report_callback() function.
+/// @param[in] info Fragment information. Will NOT be NULL.
+/// @post The data members of the reported info can NOT be accessed after the function returns.
+/// @ingroup client
+typedef void (*CC_Mqtt311MessageChunkReportCb)(void* data, const CC_Mqtt311MessageChunkInfo* info);
+
+/// @brief Callback used to pre-filter the received messages based on their topic.
+/// @details The callback is set using
+///     cc_mqtt311_client_set_topic_prefilter_callback() function.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_set_topic_prefilter_callback() function.
+/// @param[in] topic Topic of the received message, not zero terminated.
+/// @param[in] topicLen Length of the topic.
+/// @return @b true to accept the message, @b false to drop it.
+/// @ingroup client
+typedef bool (*CC_Mqtt311TopicPrefilterCb)(void* data, const char* topic, unsigned topicLen);
+
+/// @brief Callback used to allocate memory on behalf of the client.
+/// @details The callback is provided to the cc_mqtt311_client_alloc_with_allocator() function.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_alloc_with_allocator() function.
+/// @param[in] size Amount of bytes to allocate.
+/// @return Pointer to the allocated memory suitably aligned for any fundamental type, NULL on failure.
+/// @ingroup client
+typedef void* (*CC_Mqtt311AllocCb)(void* data, unsigned size);
+
+/// @brief Callback used to release memory allocated by the @ref CC_Mqtt311AllocCb callback.
+/// @details The callback is provided to the cc_mqtt311_client_alloc_with_allocator() function.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_alloc_with_allocator() function.
+/// @param[in] ptr Pointer previously returned by the @ref CC_Mqtt311AllocCb callback.
+/// @ingroup client
+typedef void (*CC_Mqtt311FreeCb)(void* data, void* ptr);
+
+/// @brief Callback used to request the thread owning the client to drain the publish queue.
+/// @details The callback is set using
+///     cc_mqtt311_client_set_publish_queue_wakeup_callback() function. It is invoked
+///     on the thread calling the cc_mqtt311_client_publish_enqueue() when the
+///     request is the first one since the last drain. The callback is
+///     expected to schedule the invocation of the cc_mqtt311_client_publish_queue_drain()
+///     on the owning thread (or tick the client) and return immediately.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_set_publish_queue_wakeup_callback() function.
+/// @ingroup publish
+typedef void (*CC_Mqtt311PublishQueueWakeupCb)(void* data);
+
+/// @brief Callback used to report the tracing records.
+/// @details The callback is set using
+///     cc_mqtt311_client_set_trace_callback() function. It is invoked synchronously
+///     from within the library at the relevant point and is expected to 
+///     return as soon as possible.
+/// @param[in] data Pointer to user data object, passed as last parameter to
+///     cc_mqtt311_client_set_trace_callback() function.
+/// @param[in] record Tracing record.
+/// @ingroup client
+typedef void (*CC_Mqtt311TraceCb)(void* data, const CC_Mqtt311TraceRecord* record);
+
 /// @brief Callback used to report completion of the "connect" operation.
 /// @param[in] data Pointer to user data object passed as last parameter to the
 ///     @b cc_mqtt311_client_connect_send().
@@ -365,6 +720,18 @@ typedef void (*CC_Mqtt311UnsubscribeCompleteCb)(void* data, CC_Mqtt311Unsubscrib
 /// @ingroup publish
 typedef void (*CC_Mqtt311PublishCompleteCb)(void* data, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
 
+/// @brief Callback used to pull the payload of the streamed "publish" operation.
+/// @details The callback is set using @b cc_mqtt311_client_publish_config_payload_source().
+///     It can be invoked multiple times for the same offset when the message is re-sent.
+/// @param[in] data Pointer to user data object passed as last parameter to the
+///     @b cc_mqtt311_client_publish_config_payload_source().
+/// @param[in] offset Offset of the requested payload bytes.
+/// @param[out] buf Buffer to write the payload bytes into.
+/// @param[in] bufLen Amount of bytes requested, never exceeds the remaining payload length.
+/// @return Amount of bytes written into the buffer, expected to be equal to @b bufLen.
+/// @ingroup publish
+typedef unsigned (*CC_Mqtt311PublishPayloadReadCb)(void* data, unsigned offset, unsigned char* buf, unsigned bufLen);
+
 #ifdef __cplusplus
 }
 #endif
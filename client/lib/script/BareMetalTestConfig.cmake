@@ -19,8 +19,8 @@ set(CC_MQTT311_CLIENT_USERNAME_FIELD_FIXED_LEN 20)
 # Limit the max length of the topics
 set(CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN ${CC_MQTT311_CLIENT_STRING_FIELD_FIXED_LEN})
 
-# Limit the length of all the binary data fields
-set (CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN 512)
+# Store the binary data fields without fixed length in the shared arena
+set (CC_MQTT311_CLIENT_FIELD_ARENA_SIZE 2048)
 
 # Limit the max "password" length
 set(CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN 50)
@@ -28,6 +28,9 @@ set(CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN 50)
 # Limit the length of the buffer required to store serialized message
 set (CC_MQTT311_CLIENT_MAX_OUTPUT_PACKET_SIZE 1024)
 
+# Limit the size of the library owned input buffer
+set (CC_MQTT311_CLIENT_INPUT_BUFFER_SIZE 1024)
+
 # Limit the amount of incomplete QoS2 messages being received in parallel
 set (CC_MQTT311_CLIENT_RECEIVE_MAX_LIMIT 4)
 
@@ -52,5 +55,14 @@ set (CC_MQTT311_CLIENT_HAS_SUB_TOPIC_VERIFICATION FALSE)
 # Limit the amount of topic filters to store when the subscription verification is enabled
 #set (CC_MQTT311_CLIENT_SUB_FILTERS_LIMIT 20)
 
+# Remove the collection of the runtime statistics
+set (CC_MQTT311_CLIENT_HAS_STATS FALSE)
+
+# Limit the amount of interned topics of the received messages
+set (CC_MQTT311_CLIENT_TOPIC_INTERN_LIMIT 8)
+
+# Limit the amount of queued thread-safe publish requests
+set (CC_MQTT311_CLIENT_PUBLISH_QUEUE_LIMIT 4)
+
 # Limit to QoS1
 set (CC_MQTT311_CLIENT_MAX_QOS 1)
\ No newline at end of file
@@ -19,7 +19,9 @@ set_default_var_value(CC_MQTT311_CLIENT_USERNAME_FIELD_FIXED_LEN 0)
 set_default_var_value(CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN 0)
 set_default_var_value(CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN 0)
 set_default_var_value(CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN 0)
+set_default_var_value(CC_MQTT311_CLIENT_FIELD_ARENA_SIZE 0)
 set_default_var_value(CC_MQTT311_CLIENT_MAX_OUTPUT_PACKET_SIZE 0)
+set_default_var_value(CC_MQTT311_CLIENT_INPUT_BUFFER_SIZE 0)
 set_default_var_value(CC_MQTT311_CLIENT_RECEIVE_MAX_LIMIT 0)
 set_default_var_value(CC_MQTT311_CLIENT_SEND_MAX_LIMIT 0)
 set_default_var_value(CC_MQTT311_CLIENT_ASYNC_SUBS_LIMIT 0)
@@ -27,5 +29,10 @@ set_default_var_value(CC_MQTT311_CLIENT_ASYNC_UNSUBS_LIMIT 0)
 set_default_var_value(CC_MQTT311_CLIENT_HAS_ERROR_LOG TRUE)
 set_default_var_value(CC_MQTT311_CLIENT_HAS_TOPIC_FORMAT_VERIFICATION TRUE)
 set_default_var_value(CC_MQTT311_CLIENT_HAS_SUB_TOPIC_VERIFICATION TRUE)
+set_default_var_value(CC_MQTT311_CLIENT_HAS_STATS TRUE)
+set_default_var_value(CC_MQTT311_CLIENT_HAS_TRACE FALSE)
 set_default_var_value(CC_MQTT311_CLIENT_SUB_FILTERS_LIMIT 0)
+set_default_var_value(CC_MQTT311_CLIENT_TOPIC_INTERN_LIMIT 0)
+set_default_var_value(CC_MQTT311_CLIENT_TOPIC_INTERN_MAX_LEN 0)
+set_default_var_value(CC_MQTT311_CLIENT_PUBLISH_QUEUE_LIMIT 0)
 set_default_var_value(CC_MQTT311_CLIENT_MAX_QOS 2)
\ No newline at end of file
@@ -2,4 +2,7 @@
 set (CC_MQTT311_CLIENT_CUSTOM_NAME "qos1")
 
 # Limit to QoS1
-set (CC_MQTT311_CLIENT_MAX_QOS 1)
\ No newline at end of file
+set (CC_MQTT311_CLIENT_MAX_QOS 1)
+
+# Enable the tracing points
+set (CC_MQTT311_CLIENT_HAS_TRACE TRUE)
\ No newline at end of file
@@ -37,6 +37,8 @@ adjust_bool_value ("CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC" "CC_MQTT311_CLIENT_HAS_
 adjust_bool_value ("CC_MQTT311_CLIENT_HAS_ERROR_LOG" "CC_MQTT311_CLIENT_HAS_ERROR_LOG_CPP")
 adjust_bool_value ("CC_MQTT311_CLIENT_HAS_TOPIC_FORMAT_VERIFICATION" "CC_MQTT311_CLIENT_HAS_TOPIC_FORMAT_VERIFICATION_CPP")
 adjust_bool_value ("CC_MQTT311_CLIENT_HAS_SUB_TOPIC_VERIFICATION" "CC_MQTT311_CLIENT_HAS_SUB_TOPIC_VERIFICATION_CPP")
+adjust_bool_value ("CC_MQTT311_CLIENT_HAS_STATS" "CC_MQTT311_CLIENT_HAS_STATS_CPP")
+adjust_bool_value ("CC_MQTT311_CLIENT_HAS_TRACE" "CC_MQTT311_CLIENT_HAS_TRACE_CPP")
 
 #########################################
 
@@ -44,7 +46,9 @@ replace_in_text (CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC_CPP)
 replace_in_text (CC_MQTT311_CLIENT_ALLOC_LIMIT)
 replace_in_text (CC_MQTT311_CLIENT_STRING_FIELD_FIXED_LEN)
 replace_in_text (CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN)
+replace_in_text (CC_MQTT311_CLIENT_FIELD_ARENA_SIZE)
 replace_in_text (CC_MQTT311_CLIENT_MAX_OUTPUT_PACKET_SIZE)
+replace_in_text (CC_MQTT311_CLIENT_INPUT_BUFFER_SIZE)
 replace_in_text (CC_MQTT311_CLIENT_RECEIVE_MAX_LIMIT)
 replace_in_text (CC_MQTT311_CLIENT_SEND_MAX_LIMIT)
 replace_in_text (CC_MQTT311_CLIENT_ASYNC_SUBS_LIMIT)
@@ -52,7 +56,12 @@ replace_in_text (CC_MQTT311_CLIENT_ASYNC_UNSUBS_LIMIT)
 replace_in_text (CC_MQTT311_CLIENT_HAS_ERROR_LOG_CPP)
 replace_in_text (CC_MQTT311_CLIENT_HAS_TOPIC_FORMAT_VERIFICATION_CPP)
 replace_in_text (CC_MQTT311_CLIENT_HAS_SUB_TOPIC_VERIFICATION_CPP)
+replace_in_text (CC_MQTT311_CLIENT_HAS_STATS_CPP)
+replace_in_text (CC_MQTT311_CLIENT_HAS_TRACE_CPP)
 replace_in_text (CC_MQTT311_CLIENT_SUB_FILTERS_LIMIT)
+replace_in_text (CC_MQTT311_CLIENT_TOPIC_INTERN_LIMIT)
+replace_in_text (CC_MQTT311_CLIENT_TOPIC_INTERN_MAX_LEN)
+replace_in_text (CC_MQTT311_CLIENT_PUBLISH_QUEUE_LIMIT)
 replace_in_text (CC_MQTT311_CLIENT_MAX_QOS)
 
 
@@ -47,6 +47,9 @@ set_default_opt (MESSAGE_UNSUBSCRIBE_FIELDS_LIST)
 set_default_opt (MAX_PACKET_SIZE)
 set_default_opt (MSG_ALLOC_OPT)
 
+set (FIELD_ARENA_STRING_OPT "comms::option::app::CustomStorageType<cc_mqtt311_client::FieldArenaString>")
+set (FIELD_ARENA_DATA_OPT "comms::option::app::CustomStorageType<cc_mqtt311_client::FieldArenaData>")
+
 #########################################
 
 # Update options
@@ -58,12 +61,16 @@ endif ()
 
 if (NOT ${CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN} EQUAL 0)
     set (FIELD_BIN_DATA "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (FIELD_BIN_DATA "${FIELD_ARENA_DATA_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_BIN_DATA_FIELD_FIXED_LEN needs to be set")    
 endif ()
 
 if (NOT ${CC_MQTT311_CLIENT_STRING_FIELD_FIXED_LEN} EQUAL 0)
     set (FIELD_STRING "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_STRING_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (FIELD_STRING "${FIELD_ARENA_STRING_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_STRING_FIELD_FIXED_LEN needs to be set")    
 endif ()
@@ -76,18 +83,24 @@ endif ()
 
 if (NOT ${CC_MQTT311_CLIENT_CLIENT_ID_FIELD_FIXED_LEN} EQUAL 0)
     set (MESSAGE_CONNECT_FIELDS_CLIENT_ID "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_CLIENT_ID_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (MESSAGE_CONNECT_FIELDS_CLIENT_ID "${FIELD_ARENA_STRING_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_CLIENT_ID_FIELD_FIXED_LEN needs to be set")    
 endif ()
 
 if (NOT ${CC_MQTT311_CLIENT_USERNAME_FIELD_FIXED_LEN} EQUAL 0)
     set (MESSAGE_CONNECT_FIELDS_USERNAME "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_USERNAME_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (MESSAGE_CONNECT_FIELDS_USERNAME "${FIELD_ARENA_STRING_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_USERNAME_FIELD_FIXED_LEN needs to be set")    
 endif ()
 
 if (NOT ${CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN} EQUAL 0)
     set (MESSAGE_CONNECT_FIELDS_PASSWORD "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (MESSAGE_CONNECT_FIELDS_PASSWORD "${FIELD_ARENA_DATA_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_PASSWORD_FIELD_FIXED_LEN needs to be set")    
 endif ()
@@ -95,6 +108,9 @@ endif ()
 if (NOT ${CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN} EQUAL 0)
     set (FIELD_TOPIC "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN}>")    
     set (MESSAGE_CONNECT_FIELDS_WILL_TOPIC "comms::option::app::FixedSizeStorage<${CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN}>")
+elseif (NOT ${CC_MQTT311_CLIENT_FIELD_ARENA_SIZE} EQUAL 0)
+    set (FIELD_TOPIC "${FIELD_ARENA_STRING_OPT}")
+    set (MESSAGE_CONNECT_FIELDS_WILL_TOPIC "${FIELD_ARENA_STRING_OPT}")
 elseif (NOT CC_MQTT311_CLIENT_HAS_DYN_MEM_ALLOC)
     message (FATAL_ERROR "When dynamic memory allocation is disabled, the CC_MQTT311_CLIENT_TOPIC_FIELD_FIXED_LEN needs to be set")    
 endif ()
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "ClientGroup.h"
 #include "ClientImpl.h"
 #include "Config.h"
 #include "ObjAllocator.h"
@@ -15,5 +16,6 @@ namespace cc_mqtt311_client
 {
 
 using ClientAllocator = ObjAllocator<ClientImpl, Config::ClientAllocLimit>;
+using ClientGroupAllocator = ObjAllocator<ClientGroup, Config::ClientAllocLimit>;
 
 } // namespace cc_mqtt311_client
@@ -0,0 +1,253 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ClientGroup.h"
+
+#include "comms/Assert.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace cc_mqtt311_client
+{
+
+ClientGroup::~ClientGroup()
+{
+    while (!m_members.empty()) {
+        remove(*m_members.back());
+    }
+}
+
+CC_Mqtt311ErrorCode ClientGroup::add(ClientImpl& client)
+{
+    auto& state = client.groupState();
+    if (state.m_group != nullptr) {
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_members.push_back(&client);
+    state = GroupState();
+    state.m_group = this;
+
+    TickCallbacks callbacks;
+    callbacks.m_programCb = &ClientGroup::nextTickProgramCb;
+    callbacks.m_programData = &client;
+    callbacks.m_cancelCb = &ClientGroup::cancelNextTickWaitCb;
+    callbacks.m_cancelData = &client;
+    state.m_appCallbacks = client.replaceTickCallbacks(callbacks);
+
+    // Take over the measurement requested via the application callbacks
+    unsigned elapsed = 0U;
+    auto& appCallbacks = state.m_appCallbacks;
+    if ((appCallbacks.m_programCb != nullptr) && 
+        (appCallbacks.m_cancelCb != nullptr) && 
+        (0U < client.timerMgr().getMinWait())) {
+        elapsed = appCallbacks.m_cancelCb(appCallbacks.m_cancelData);
+    }
+
+    client.tick(elapsed);
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+CC_Mqtt311ErrorCode ClientGroup::remove(ClientImpl& client)
+{
+    auto& state = client.groupState();
+    if (state.m_group != this) {
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    auto elapsed = cancel(client);
+    detach(client);
+
+    // The application callbacks take over the remaining measurement
+    client.tick(elapsed);
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+void ClientGroup::detach(ClientImpl& client)
+{
+    auto& state = client.groupState();
+    COMMS_ASSERT(state.m_group == this);
+    if (state.m_heapPos != 0U) {
+        heapRemove(state.m_heapPos - 1U);
+    }
+
+    auto iter = std::find(m_members.begin(), m_members.end(), &client);
+    COMMS_ASSERT(iter != m_members.end());
+    if (iter != m_members.end()) {
+        m_members.erase(iter);
+    }
+
+    // The client can be freed by the callbacks of another member being ticked,
+    // the expired list cannot keep the dangling pointer.
+    std::replace(m_expired.begin(), m_expired.end(), &client, static_cast<ClientImpl*>(nullptr));
+
+    client.replaceTickCallbacks(state.m_appCallbacks);
+    state = GroupState();
+}
+
+unsigned ClientGroup::tick(unsigned ms)
+{
+    m_now += ms;
+
+    COMMS_ASSERT(m_expired.empty());
+    while ((!m_heap.empty()) && (m_heap.front()->groupState().m_deadline <= m_now)) {
+        m_expired.push_back(m_heap.front());
+        heapRemove(0U);
+    }
+
+    for (auto* client : m_expired) {
+        if (client == nullptr) {
+            // Detached by the callbacks of the previously ticked members
+            continue;
+        }
+
+        auto& state = client->groupState();
+        if ((state.m_group != this) || (!state.m_programmed) || (state.m_heapPos != 0U)) {
+            // Removed or rescheduled by the callbacks of the previously ticked members
+            continue;
+        }
+
+        state.m_programmed = false;
+        client->tick(static_cast<unsigned>(m_now - state.m_programmedAt));
+    }
+
+    m_expired.clear();
+    return nextTick();
+}
+
+unsigned ClientGroup::nextTick() const
+{
+    if (m_heap.empty()) {
+        return 0U;
+    }
+
+    auto deadline = m_heap.front()->groupState().m_deadline;
+    COMMS_ASSERT(m_now < deadline);
+    return static_cast<unsigned>(deadline - m_now);
+}
+
+void ClientGroup::nextTickProgramCb(void* data, unsigned duration)
+{
+    auto* client = reinterpret_cast<ClientImpl*>(data);
+    auto* group = client->groupState().m_group;
+    COMMS_ASSERT(group != nullptr);
+    group->program(*client, duration);
+}
+
+unsigned ClientGroup::cancelNextTickWaitCb(void* data)
+{
+    auto* client = reinterpret_cast<ClientImpl*>(data);
+    auto* group = client->groupState().m_group;
+    COMMS_ASSERT(group != nullptr);
+    return group->cancel(*client);
+}
+
+void ClientGroup::program(ClientImpl& client, unsigned duration)
+{
+    auto& state = client.groupState();
+    if (state.m_heapPos != 0U) {
+        heapRemove(state.m_heapPos - 1U);
+    }
+
+    state.m_programmed = true;
+    state.m_programmedAt = m_now;
+    state.m_deadline = m_now + std::max(duration, 1U);
+    heapPush(client);
+}
+
+unsigned ClientGroup::cancel(ClientImpl& client)
+{
+    auto& state = client.groupState();
+    if (!state.m_programmed) {
+        return 0U;
+    }
+
+    if (state.m_heapPos != 0U) {
+        heapRemove(state.m_heapPos - 1U);
+    }
+
+    state.m_programmed = false;
+    return static_cast<unsigned>(m_now - state.m_programmedAt);
+}
+
+bool ClientGroup::isEarlier(unsigned first, unsigned second) const
+{
+    return m_heap[first]->groupState().m_deadline < m_heap[second]->groupState().m_deadline;
+}
+
+void ClientGroup::heapPush(ClientImpl& client)
+{
+    m_heap.push_back(&client);
+    auto idx = static_cast<unsigned>(m_heap.size() - 1U);
+    client.groupState().m_heapPos = idx + 1U;
+    heapSiftUp(idx);
+}
+
+void ClientGroup::heapRemove(unsigned idx)
+{
+    COMMS_ASSERT(idx < m_heap.size());
+    m_heap[idx]->groupState().m_heapPos = 0U;
+
+    auto lastIdx = static_cast<unsigned>(m_heap.size() - 1U);
+    if (idx != lastIdx) {
+        m_heap[idx] = m_heap[lastIdx];
+        m_heap[idx]->groupState().m_heapPos = idx + 1U;
+    }
+
+    m_heap.pop_back();
+    if (idx < m_heap.size()) {
+        heapSiftDown(heapSiftUp(idx));
+    }
+}
+
+void ClientGroup::heapSwap(unsigned first, unsigned second)
+{
+    std::swap(m_heap[first], m_heap[second]);
+    m_heap[first]->groupState().m_heapPos = first + 1U;
+    m_heap[second]->groupState().m_heapPos = second + 1U;
+}
+
+unsigned ClientGroup::heapSiftUp(unsigned idx)
+{
+    while (0U < idx) {
+        auto parent = (idx - 1U) / 2U;
+        if (!isEarlier(idx, parent)) {
+            break;
+        }
+
+        heapSwap(idx, parent);
+        idx = parent;
+    }
+
+    return idx;
+}
+
+void ClientGroup::heapSiftDown(unsigned idx)
+{
+    auto count = static_cast<unsigned>(m_heap.size());
+    while (true) {
+        auto next = (idx * 2U) + 1U;
+        if (count <= next) {
+            break;
+        }
+
+        auto right = next + 1U;
+        if ((right < count) && (isEarlier(right, next))) {
+            next = right;
+        }
+
+        if (!isEarlier(next, idx)) {
+            break;
+        }
+
+        heapSwap(idx, next);
+        idx = next;
+    }
+}
+
+} // namespace cc_mqtt311_client
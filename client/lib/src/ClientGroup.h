@@ -0,0 +1,70 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ClientImpl.h"
+#include "Config.h"
+#include "ObjListType.h"
+
+#include "cc_mqtt311_client/common.h"
+
+#include <cstdint>
+
+namespace cc_mqtt311_client
+{
+
+// Drives the timers of multiple clients from a single clock. The time 
+// measurement requests of the members are kept in a binary min-heap ordered 
+// by the absolute deadline, the earliest one is the wait of the whole group.
+class ClientGroup
+{
+public:
+    ClientGroup() = default;
+    ClientGroup(const ClientGroup&) = delete;
+    ~ClientGroup();
+
+    ClientGroup& operator=(const ClientGroup&) = delete;
+
+    CC_Mqtt311ErrorCode add(ClientImpl& client);
+    CC_Mqtt311ErrorCode remove(ClientImpl& client);
+
+    // Leave the group without handing over the measurement in progress,
+    // used when the client is being freed.
+    void detach(ClientImpl& client);
+
+    unsigned tick(unsigned ms);
+    unsigned nextTick() const;
+
+    unsigned count() const
+    {
+        return static_cast<unsigned>(m_members.size());
+    }
+
+private:
+    using ClientsList = ObjListType<ClientImpl*, Config::ClientAllocLimit>;
+
+    static void nextTickProgramCb(void* data, unsigned duration);
+    static unsigned cancelNextTickWaitCb(void* data);
+
+    void program(ClientImpl& client, unsigned duration);
+    unsigned cancel(ClientImpl& client);
+
+    bool isEarlier(unsigned first, unsigned second) const;
+    void heapPush(ClientImpl& client);
+    void heapRemove(unsigned idx);
+    void heapSwap(unsigned first, unsigned second);
+    unsigned heapSiftUp(unsigned idx);
+    void heapSiftDown(unsigned idx);
+
+    ClientsList m_members;
+    ClientsList m_heap;
+    ClientsList m_expired;
+    std::uint64_t m_now = 0U;
+};
+
+} // namespace cc_mqtt311_client
@@ -13,7 +13,9 @@
 #include "comms/util/ScopeGuard.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace cc_mqtt311_client
 {
@@ -49,13 +51,78 @@ void updateEc(CC_Mqtt311ErrorCode* ec, CC_Mqtt311ErrorCode val)
     }
 }
 
+template <typename TList>
+std::size_t opsHeapBytes(const TList& list, bool pooled)
+{
+    if constexpr (objListIsDynamic<TList>()) {
+        // The operations are allocated one by one when there is no limit
+        using ObjType = typename TList::value_type::element_type;
+        return pooled ? 0U : list.size() * sizeof(ObjType);
+    }
+    else {
+        static_cast<void>(list);
+        static_cast<void>(pooled);
+        return 0U;
+    }
+}
+
+// The zero value of the priority is the default one, the numeric values are not ordered
+unsigned priorityRank(CC_Mqtt311PublishPriority priority)
+{
+    static const unsigned Map[] = {
+        /* CC_Mqtt311PublishPriority_Normal */ 1U,
+        /* CC_Mqtt311PublishPriority_Low */ 0U,
+        /* CC_Mqtt311PublishPriority_High */ 2U,
+    };
+    static constexpr std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == CC_Mqtt311PublishPriority_ValuesLimit);
+
+    COMMS_ASSERT(static_cast<unsigned>(priority) < MapSize);
+    return Map[priority];
+}
+
+CC_Mqtt311AsyncOpStatus queuedPublishStatus(CC_Mqtt311ErrorCode ec)
+{
+    switch (ec) {
+        case CC_Mqtt311ErrorCode_NotConnected: 
+        case CC_Mqtt311ErrorCode_Disconnecting: 
+        case CC_Mqtt311ErrorCode_NetworkDisconnected: 
+            return CC_Mqtt311AsyncOpStatus_BrokerDisconnected;
+        case CC_Mqtt311ErrorCode_OutOfMemory:
+            return CC_Mqtt311AsyncOpStatus_OutOfMemory;
+        case CC_Mqtt311ErrorCode_BadParam:
+        case CC_Mqtt311ErrorCode_InsufficientConfig:
+            return CC_Mqtt311AsyncOpStatus_BadParam;
+        default:
+            break;
+    }
+
+    return CC_Mqtt311AsyncOpStatus_Aborted;
+}
+
 } // namespace 
 
-ClientImpl::ClientImpl() = default;
+ClientImpl::ClientImpl() : 
+    m_resendPacingTimer(m_timerMgr.allocTimer()),
+    m_connectOpAlloc(m_memPool),
+    m_keepAliveOpsAlloc(m_memPool),
+    m_disconnectOpsAlloc(m_memPool),
+    m_subscribeOpsAlloc(m_memPool),
+    m_unsubscribeOpsAlloc(m_memPool),
+    m_recvOpsAlloc(m_memPool),
+    m_sendOpsAlloc(m_memPool)
+{
+    COMMS_ASSERT(m_resendPacingTimer.isValid());
+    m_timerMgr.setTrace(&m_trace);
+}
 
 ClientImpl::~ClientImpl()
 {
     COMMS_ASSERT(m_apiEnterCount == 0U);
+    
+    // The in-flight messages are not discarded, they are expected
+    // to be restored from the session store after the restart.
+    m_sessionStoreCb = nullptr; 
     terminateOps(CC_Mqtt311AsyncOpStatus_Aborted, TerminateMode_AbortSendRecvOps);
 }
 
@@ -65,12 +132,14 @@ void ClientImpl::tick(unsigned ms)
     COMMS_ASSERT(m_apiEnterCount == 0U);
     ++m_apiEnterCount;
     m_timerMgr.tick(ms);
+    drainPublishQueue();
     doApiExit();
 }
 
 unsigned ClientImpl::processData(const std::uint8_t* iter, unsigned len)
 {
     auto guard = apiEnter();
+    drainPublishQueue();
     COMMS_ASSERT(!m_clientState.m_networkDisconnected);
     
     if (m_clientState.m_networkDisconnected) {
@@ -78,6 +147,7 @@ unsigned ClientImpl::processData(const std::uint8_t* iter, unsigned len)
         return 0U;
     }
 
+    m_trace.processDataEnter(len);
     auto disconnectOnExitGuard = 
         comms::util::makeScopeGuard(
             [this]()
@@ -85,24 +155,44 @@ unsigned ClientImpl::processData(const std::uint8_t* iter, unsigned len)
                 brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError, CC_Mqtt311AsyncOpStatus_ProtocolError);
             });
 
+    using IdAndFlagsField = ProtFrame::Layer_idAndFlags::Field;
+    static_assert(IdAndFlagsField::minLength() == IdAndFlagsField::maxLength());
+
+    using SizeField = ProtFrame::Layer_size::Field;
+    static constexpr unsigned MinHeaderLen = IdAndFlagsField::minLength() + SizeField::minLength();
+
     unsigned consumed = 0;
+    unsigned required = MinHeaderLen;
+    auto traceExitGuard = 
+        comms::util::makeScopeGuard(
+            [this, &consumed]()
+            {
+                m_trace.processDataExit(consumed);
+            });
+
     while (consumed < len) {
         auto remLen = len - consumed;
-        auto* iterTmp = iter;
-
-        using IdAndFlagsField = ProtFrame::Layer_idAndFlags::Field;
-        static_assert(IdAndFlagsField::minLength() == IdAndFlagsField::maxLength());
+        if (m_recvStream.m_active) {
+            auto streamConsumed = processRecvStream(iter, remLen);
+            consumed += streamConsumed;
+            std::advance(iter, streamConsumed);
+            continue;
+        }
 
-        if (remLen <= IdAndFlagsField::minLength()) {
+        auto* iterTmp = iter;
+        if (remLen < MinHeaderLen) {
             // Size info is not available
+            required = MinHeaderLen - remLen;
             break;
         }
 
-        using SizeField = ProtFrame::Layer_size::Field;
+        // The fixed header is decoded once to find out the packet boundary,
+        // the frame is read only when the whole packet is available.
         SizeField sizeField;
         std::advance(iterTmp, IdAndFlagsField::minLength());
         auto es = sizeField.read(iterTmp, remLen - IdAndFlagsField::minLength());
         if (es == comms::ErrorStatus::NotEnoughData) {
+            required = 1U;
             break;
         }
 
@@ -110,28 +200,110 @@ unsigned ClientImpl::processData(const std::uint8_t* iter, unsigned len)
             return len; // Disconnect
         }        
 
-        iterTmp = iter;
-        ProtFrame::MsgPtr msg;
-        es = m_frame.read(msg, iterTmp, remLen);
-        if (es == comms::ErrorStatus::NotEnoughData) {
+        auto hdrLen = static_cast<unsigned>(std::distance(iter, iterTmp));
+        if (isRecvStreamRequired(*iter, sizeField.value())) {
+            es = startRecvStream(*iter, iterTmp, remLen - hdrLen, sizeField.value());
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                required = 1U;
+                break;
+            }
+
+            if (es != comms::ErrorStatus::Success) {
+                errorLog("Unexpected error in streamed PUBLISH header parsing");
+                return len;
+            }
+
+            m_stats.packetIn(cc_mqtt311::MsgId_Publish, hdrLen + sizeField.value());
+            m_trace.publishDispatch(hdrLen + sizeField.value());
+
+            consumed += static_cast<unsigned>(std::distance(iter, iterTmp));
+            iter = iterTmp;
+
+            if (m_recvStream.m_totalLen == 0U) {
+                processRecvStream(iter, 0U);
+            }
+            continue;
+        }
+
+        auto packetLen = hdrLen + sizeField.value();
+        if (remLen < packetLen) {
+            required = packetLen - remLen;
             break;
         }
 
+        if (isLazyPublishDecode(*iter)) {
+            m_stats.packetIn(cc_mqtt311::MsgId_Publish, packetLen);
+            m_trace.publishDispatch(packetLen);
+            es = processLazyPublish(*iter, iterTmp, sizeField.value());
+            if (es != comms::ErrorStatus::Success) {
+                errorLog("Unexpected error in PUBLISH parsing");
+                return len;
+            }
+
+            consumed += packetLen;
+            std::advance(iter, packetLen);
+            continue;
+        }
+
+        // The header has already been decoded, only the body is read
+        auto msg = m_frame.layer_idAndFlags().createMsg(static_cast<cc_mqtt311::MsgId>(*iter >> 4U));
+        if (!msg) {
+            errorLog("Unexpected message id in the incoming packet");
+            return len;
+        }
+
+        setTransportFlags(*msg, *iter);
+        es = msg->read(iterTmp, sizeField.value());
         if (es != comms::ErrorStatus::Success) {
-            errorLog("Unexpected error in framing / payload parsing");
+            errorLog("Unexpected error in payload parsing");
             return len;
         }
 
-        COMMS_ASSERT(msg);
+        if (isFieldArenaExhausted(*msg, sizeField.value())) {
+            errorLog("Failed to store the incoming message fields, the field arena is exhausted");
+            return len;
+        }
+
+        m_stats.packetIn(msg->getId(), packetLen);
+        m_trace.msgDispatch(*msg, packetLen);
         msg->dispatch(*this);
-        consumed += static_cast<unsigned>(std::distance(iter, iterTmp));
-        iter = iterTmp;
+        consumed += packetLen;
+        std::advance(iter, packetLen);
     }
 
+    if (m_recvStream.m_active) {
+        required = m_recvStream.m_totalLen - m_recvStream.m_offset;
+    }
+
+    m_clientState.m_inputRequiredBytes = required;
+
     disconnectOnExitGuard.release();
+    m_stats.processData(consumed);
     return consumed;    
 }
 
+std::uint8_t* ClientImpl::inputBufferAcquire(unsigned& len)
+{
+    return m_inBuf.acquire(m_clientState.m_inputRequiredBytes, len);
+}
+
+unsigned ClientImpl::inputBufferCommit(unsigned len)
+{
+    m_inBuf.commit(len);
+    m_clientState.m_inputBufCommitInProgress = true;
+    auto consumed = processData(m_inBuf.data(), m_inBuf.size());
+    m_clientState.m_inputBufCommitInProgress = false;
+    if (m_clientState.m_inputBufResetPending) {
+        // The connection has been re-prepared by the callback
+        m_clientState.m_inputBufResetPending = false;
+        resetInput();
+        return consumed;
+    }
+
+    m_inBuf.consume(consumed);
+    return consumed;
+}
+
 void ClientImpl::notifyNetworkDisconnected()
 {
     auto guard = apiEnter();
@@ -148,12 +320,41 @@ bool ClientImpl::isNetworkDisconnected() const
     return m_clientState.m_networkDisconnected;
 }
 
+void ClientImpl::notifyOutputBlocked()
+{
+    m_clientState.m_outputBlocked = true;
+}
+
+void ClientImpl::notifyOutputWritable()
+{
+    if (!m_clientState.m_outputBlocked) {
+        return;
+    }
+
+    auto guard = apiEnter();
+    m_clientState.m_outputBlocked = false;
+    if ((!m_sessionState.m_connected) || m_sessionState.m_disconnecting) {
+        return;
+    }
+
+    if (m_sessionState.m_reconnectResendInProgress) {
+        if (!m_resendPacingTimer.isActive()) {
+            resumeReconnectionResend();
+        }
+
+        return;
+    }
+
+    resumeSendOpsSince(0U);
+}
+
 
 op::ConnectOp* ClientImpl::connectPrepare(CC_Mqtt311ErrorCode* ec)
 {
     op::ConnectOp* connectOp = nullptr;
     do {
         m_clientState.m_networkDisconnected = false;
+        m_clientState.m_outputBlocked = false;
 
         if (!m_clientState.m_initialized) {
             if (m_apiEnterCount > 0U) {
@@ -207,9 +408,19 @@ op::ConnectOp* ClientImpl::connectPrepare(CC_Mqtt311ErrorCode* ec)
             break;
         }
 
+        // The remains of the previous connection are discarded
+        if (m_clientState.m_inputBufCommitInProgress) {
+            m_clientState.m_inputBufResetPending = true;
+        }
+        else {
+            resetInput();
+        }
+
         m_preparationLocked = true;
+        m_trace.opCreate(*ptr);
         m_ops.push_back(ptr.get());
         m_connectOps.push_back(std::move(ptr));
+        updateOpsHighWaterMarks();
         connectOp = m_connectOps.back().get();
         updateEc(ec, CC_Mqtt311ErrorCode_Success);
     } while (false);
@@ -265,8 +476,10 @@ op::DisconnectOp* ClientImpl::disconnectPrepare(CC_Mqtt311ErrorCode* ec)
         }
 
         m_preparationLocked = true;
+        m_trace.opCreate(*ptr);
         m_ops.push_back(ptr.get());
         m_disconnectOps.push_back(std::move(ptr));
+        updateOpsHighWaterMarks();
         disconnectOp = m_disconnectOps.back().get();
         updateEc(ec, CC_Mqtt311ErrorCode_Success);
     } while (false);
@@ -316,8 +529,10 @@ op::SubscribeOp* ClientImpl::subscribePrepare(CC_Mqtt311ErrorCode* ec)
         }
 
         m_preparationLocked = true;
+        m_trace.opCreate(*ptr);
         m_ops.push_back(ptr.get());
         m_subscribeOps.push_back(std::move(ptr));
+        updateOpsHighWaterMarks();
         subOp = m_subscribeOps.back().get();
         updateEc(ec, CC_Mqtt311ErrorCode_Success);
     } while (false);
@@ -367,8 +582,10 @@ op::UnsubscribeOp* ClientImpl::unsubscribePrepare(CC_Mqtt311ErrorCode* ec)
         }
 
         m_preparationLocked = true;
+        m_trace.opCreate(*ptr);
         m_ops.push_back(ptr.get());
         m_unsubscribeOps.push_back(std::move(ptr));
+        updateOpsHighWaterMarks();
         unsubOp = m_unsubscribeOps.back().get();
         updateEc(ec, CC_Mqtt311ErrorCode_Success);
     } while (false);
@@ -380,19 +597,21 @@ op::SendOp* ClientImpl::publishPrepare(CC_Mqtt311ErrorCode* ec)
 {
     op::SendOp* sendOp = nullptr;
     do {
-        if (!m_sessionState.m_connected) {
+        // The offline queue accepts publishes regardless of the connection state
+        bool connectionRequired = !m_configState.m_offlineQueueEnabled;
+        if (connectionRequired && (!m_sessionState.m_connected)) {
             errorLog("Client must be connected to allow publish.");
             updateEc(ec, CC_Mqtt311ErrorCode_NotConnected);
             break;
         }
 
-        if (m_sessionState.m_disconnecting) {
+        if (connectionRequired && m_sessionState.m_disconnecting) {
             errorLog("Session disconnection is in progress, cannot initiate publish.");
             updateEc(ec, CC_Mqtt311ErrorCode_Disconnecting);
             break;
         }
 
-        if (m_clientState.m_networkDisconnected) {
+        if (connectionRequired && m_clientState.m_networkDisconnected) {
             errorLog("Network is disconnected.");
             updateEc(ec, CC_Mqtt311ErrorCode_NetworkDisconnected);
             break;            
@@ -418,8 +637,10 @@ op::SendOp* ClientImpl::publishPrepare(CC_Mqtt311ErrorCode* ec)
         }          
 
         m_preparationLocked = true;
+        m_trace.opCreate(*ptr);
         m_ops.push_back(ptr.get());
         m_sendOps.push_back(std::move(ptr));
+        updateOpsHighWaterMarks();
         sendOp = m_sendOps.back().get();
         updateEc(ec, CC_Mqtt311ErrorCode_Success);
     } while (false);
@@ -427,6 +648,49 @@ op::SendOp* ClientImpl::publishPrepare(CC_Mqtt311ErrorCode* ec)
     return sendOp;
 }
 
+CC_Mqtt311ErrorCode ClientImpl::publishRestore(
+    const CC_Mqtt311PublishRestoreConfig& config, 
+    CC_Mqtt311PublishCompleteCb cb, 
+    void* cbData)
+{
+    if (m_sessionState.m_connected) {
+        errorLog("Publish can be restored only before the connection to broker.");
+        return CC_Mqtt311ErrorCode_AlreadyConnected;
+    }
+
+    if (!m_connectOps.empty()) {
+        errorLog("Publish cannot be restored when connection is in progress.");
+        return CC_Mqtt311ErrorCode_Busy;
+    }
+
+    if (m_ops.max_size() <= m_ops.size()) {
+        errorLog("Cannot restore publish operation, retry in next event loop iteration.");
+        return CC_Mqtt311ErrorCode_RetryLater;
+    }
+
+    if (m_preparationLocked) {
+        errorLog("Another operation is being prepared, cannot restore \"publish\" without \"send\" or \"cancel\" of the previous.");
+        return CC_Mqtt311ErrorCode_PreparationLocked;
+    }
+
+    auto ptr = m_sendOpsAlloc.alloc(*this);
+    if (!ptr) {
+        errorLog("Cannot allocate new publish operation.");
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
+    auto ec = ptr->restore(config, cb, cbData);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        return ec;
+    }
+
+    m_trace.opCreate(*ptr);
+    m_ops.push_back(ptr.get());
+    m_sendOps.push_back(std::move(ptr));
+    updateOpsHighWaterMarks();
+    return CC_Mqtt311ErrorCode_Success;
+}
+
 CC_Mqtt311ErrorCode ClientImpl::setPublishOrdering(CC_Mqtt311PublishOrdering ordering)
 {
     if (CC_Mqtt311PublishOrdering_ValuesLimit <= ordering) {
@@ -438,6 +702,306 @@ CC_Mqtt311ErrorCode ClientImpl::setPublishOrdering(CC_Mqtt311PublishOrdering ord
     return CC_Mqtt311ErrorCode_Success;
 }
 
+CC_Mqtt311ErrorCode ClientImpl::setResendPacing(const CC_Mqtt311ResendPacingConfig& config)
+{
+    if (config.m_intervalMs == 0U) {
+        errorLog("Resend pacing interval must be greater than 0");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_configState.m_resendPacingMaxMsgs = config.m_maxMsgs;
+    m_configState.m_resendPacingMaxBytes = config.m_maxBytes;
+    m_configState.m_resendPacingIntervalMs = config.m_intervalMs;
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+void ClientImpl::getResendPacing(CC_Mqtt311ResendPacingConfig& config) const
+{
+    config.m_maxMsgs = m_configState.m_resendPacingMaxMsgs;
+    config.m_maxBytes = m_configState.m_resendPacingMaxBytes;
+    config.m_intervalMs = m_configState.m_resendPacingIntervalMs;
+}
+
+CC_Mqtt311ErrorCode ClientImpl::setOfflineQueue(const CC_Mqtt311OfflineQueueConfig& config)
+{
+    if (CC_Mqtt311OfflineQueueDropPolicy_ValuesLimit <= config.m_dropPolicy) {
+        errorLog("Bad offline queue drop policy value");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_configState.m_offlineQueueEnabled = config.m_enabled;
+    m_configState.m_offlineQueueMaxMsgs = config.m_maxMsgs;
+    m_configState.m_offlineQueueMaxBytes = config.m_maxBytes;
+    m_configState.m_offlineQueueDropPolicy = config.m_dropPolicy;
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+void ClientImpl::getOfflineQueue(CC_Mqtt311OfflineQueueConfig& config) const
+{
+    config.m_enabled = m_configState.m_offlineQueueEnabled;
+    config.m_maxMsgs = m_configState.m_offlineQueueMaxMsgs;
+    config.m_maxBytes = m_configState.m_offlineQueueMaxBytes;
+    config.m_dropPolicy = m_configState.m_offlineQueueDropPolicy;
+}
+
+CC_Mqtt311ErrorCode ClientImpl::getPriorityStats(CC_Mqtt311PublishPriority priority, CC_Mqtt311PublishPriorityStats& stats) const
+{
+    if (CC_Mqtt311PublishPriority_ValuesLimit <= priority) {
+        errorLog("Bad publish priority value");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    stats = m_clientState.m_priorityStats[priority];
+    stats.m_pausedCount = 
+        static_cast<unsigned>(
+            std::count_if(
+                m_sendOps.begin(), m_sendOps.end(),
+                [priority](auto& opPtr)
+                {
+                    return opPtr->isPaused() && (opPtr->priority() == priority);
+                }));
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+void ClientImpl::setLeanMode(bool value)
+{
+    // The idle memory is released on exit
+    auto guard = apiEnter();
+    m_configState.m_leanMode = value;
+}
+
+void ClientImpl::getMemoryFootprint(CC_Mqtt311MemoryFootprint& info) const
+{
+    auto pooled = m_memPool.isEnabled();
+    auto ops = 
+        opsHeapBytes(m_connectOps, pooled) +
+        opsHeapBytes(m_keepAliveOps, pooled) +
+        opsHeapBytes(m_disconnectOps, pooled) +
+        opsHeapBytes(m_subscribeOps, pooled) +
+        opsHeapBytes(m_unsubscribeOps, pooled) +
+        opsHeapBytes(m_recvOps, pooled) +
+        opsHeapBytes(m_sendOps, pooled);
+
+    auto opsLists = 
+        objListHeapBytes(m_connectOps) +
+        objListHeapBytes(m_keepAliveOps) +
+        objListHeapBytes(m_disconnectOps) +
+        objListHeapBytes(m_subscribeOps) +
+        objListHeapBytes(m_unsubscribeOps) +
+        objListHeapBytes(m_recvOps) +
+        objListHeapBytes(m_sendOps) +
+        objListHeapBytes(m_ops);
+
+    info.m_clientObj = static_cast<unsigned>(sizeof(ClientImpl));
+    info.m_ops = static_cast<unsigned>(ops);
+    info.m_opsLists = static_cast<unsigned>(opsLists);
+    info.m_outputBuf = static_cast<unsigned>(objListHeapBytes(m_buf));
+    info.m_inputBuf = static_cast<unsigned>(m_inBuf.heapBytes());
+    info.m_timers = static_cast<unsigned>(m_timerMgr.heapBytes());
+    info.m_memPool = static_cast<unsigned>(m_memPool.chunksBytes());
+    info.m_topicIntern = static_cast<unsigned>(m_topicIntern.heapBytes());
+    info.m_publishQueue = static_cast<unsigned>(m_publishQueue.heapBytes());
+    info.m_latencyStats = static_cast<unsigned>(m_latency.heapBytes());
+    info.m_traceRing = static_cast<unsigned>(m_trace.heapBytes());
+    info.m_total = 
+        info.m_clientObj + 
+        info.m_ops + 
+        info.m_opsLists + 
+        info.m_outputBuf + 
+        info.m_inputBuf + 
+        info.m_timers + 
+        info.m_memPool + 
+        info.m_topicIntern + 
+        info.m_publishQueue + 
+        info.m_latencyStats + 
+        info.m_traceRing;
+}
+
+CC_Mqtt311ErrorCode ClientImpl::setOutputBufShrink(const CC_Mqtt311OutputBufShrinkConfig& config)
+{
+    if constexpr (!objListIsDynamic<OutputBuf>()) {
+        if (config.m_threshold > 0U) {
+            errorLog("Output buffer has fixed capacity");
+            return CC_Mqtt311ErrorCode_NotSupported;
+        }
+    }
+
+    // The buffer is shrunk on exit when applicable
+    auto guard = apiEnter();
+    m_configState.m_outputBufShrinkThreshold = config.m_threshold;
+    m_configState.m_outputBufShrinkDecayMs = config.m_decayMs;
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+void ClientImpl::getOutputBufShrink(CC_Mqtt311OutputBufShrinkConfig& config) const
+{
+    config.m_threshold = m_configState.m_outputBufShrinkThreshold;
+    config.m_decayMs = m_configState.m_outputBufShrinkDecayMs;
+}
+
+void ClientImpl::getHighWaterMarks(CC_Mqtt311HighWaterMarks& marks) const
+{
+    marks = m_clientState.m_highWaterMarks;
+    marks.m_timers = m_timerMgr.allocHighWaterMark();
+}
+
+CC_Mqtt311ErrorCode ClientImpl::getStats(CC_Mqtt311ClientStats& stats) const
+{
+    if constexpr (!ClientStats::isEnabled()) {
+        static_cast<void>(stats);
+        return CC_Mqtt311ErrorCode_NotSupported;
+    }
+    else {
+        m_stats.get(stats);
+        stats.m_inflightSendOps = 0U;
+        stats.m_pausedSendOps = 0U;
+        for (auto& opPtr : m_sendOps) {
+            if (opPtr->isPaused()) {
+                ++stats.m_pausedSendOps;
+                continue;
+            }
+
+            ++stats.m_inflightSendOps;
+        }
+
+        stats.m_inflightRecvOps = static_cast<unsigned>(m_recvOps.size());
+        stats.m_allocatedPacketIds = static_cast<unsigned>(m_clientState.m_allocatedPacketIds.size());
+        stats.m_timers = m_timerMgr.allocCount();
+        return CC_Mqtt311ErrorCode_Success;
+    }
+}
+
+CC_Mqtt311ErrorCode ClientImpl::setLatencyTracking(bool enabled)
+{
+    if constexpr (!LatencyTracker::isEnabled()) {
+        static_cast<void>(enabled);
+        return CC_Mqtt311ErrorCode_NotSupported;
+    }
+    else {
+        if (!m_latency.setEnabled(enabled)) {
+            errorLog("Failed to allocate latency histograms");
+            return CC_Mqtt311ErrorCode_OutOfMemory;
+        }
+
+        return CC_Mqtt311ErrorCode_Success;
+    }
+}
+
+CC_Mqtt311ErrorCode ClientImpl::getLatencyStats(CC_Mqtt311LatencyType type, CC_Mqtt311LatencyStats& stats) const
+{
+    if constexpr (!LatencyTracker::isEnabled()) {
+        static_cast<void>(type);
+        static_cast<void>(stats);
+        return CC_Mqtt311ErrorCode_NotSupported;
+    }
+    else {
+        if (CC_Mqtt311LatencyType_ValuesLimit <= type) {
+            errorLog("Invalid latency type");
+            return CC_Mqtt311ErrorCode_BadParam;
+        }
+
+        m_latency.get(type, stats);
+        return CC_Mqtt311ErrorCode_Success;
+    }
+}
+
+CC_Mqtt311ErrorCode ClientImpl::setTraceCallback(CC_Mqtt311TraceCb cb, void* data)
+{
+    if constexpr (!ClientTrace::isEnabled()) {
+        static_cast<void>(cb);
+        static_cast<void>(data);
+        return CC_Mqtt311ErrorCode_NotSupported;
+    }
+    else {
+        m_trace.setCallback(cb, data);
+        return CC_Mqtt311ErrorCode_Success;
+    }
+}
+
+CC_Mqtt311ErrorCode ClientImpl::setTraceRingCapacity(unsigned capacity)
+{
+    if constexpr ((!ClientTrace::isEnabled()) || (!TraceRing::isSupported())) {
+        static_cast<void>(capacity);
+        return CC_Mqtt311ErrorCode_NotSupported;
+    }
+    else {
+        if (!m_trace.ring().setCapacity(capacity)) {
+            errorLog("Failed to allocate tracing ring");
+            return CC_Mqtt311ErrorCode_OutOfMemory;
+        }
+
+        return CC_Mqtt311ErrorCode_Success;
+    }
+}
+
+unsigned ClientImpl::traceRingRead(CC_Mqtt311TraceRecord* records, unsigned maxCount)
+{
+    if constexpr ((!ClientTrace::isEnabled()) || (!TraceRing::isSupported())) {
+        static_cast<void>(records);
+        static_cast<void>(maxCount);
+        return 0U;
+    }
+    else {
+        return m_trace.ring().read(records, maxCount);
+    }
+}
+
+void ClientImpl::resetHighWaterMarks()
+{
+    // Restart tracking from the current usage
+    auto& marks = m_clientState.m_highWaterMarks;
+    marks = CC_Mqtt311HighWaterMarks();
+    updateOpsHighWaterMarks();
+    m_timerMgr.resetAllocHighWaterMark();
+}
+
+unsigned ClientImpl::drainPublishQueue()
+{
+    if constexpr (!PublishQueue::isSupported()) {
+        return 0U;
+    }
+
+    auto guard = apiEnter();
+    m_publishQueue.rearmWakeup();
+
+    unsigned count = 0U;
+    while (true) {
+        auto* entry = m_publishQueue.front();
+        if (entry == nullptr) {
+            break;
+        }
+
+        auto ec = CC_Mqtt311ErrorCode_Success;
+        auto* sendOp = publishPrepare(&ec);
+        if ((ec == CC_Mqtt311ErrorCode_RetryLater) || (ec == CC_Mqtt311ErrorCode_PreparationLocked)) {
+            // Remain in the queue until the next drain
+            break;
+        }
+
+        // Released from the ring before any callback can re-enter the drain,
+        // the owned storage buffer is moved along.
+        auto req = std::move(*entry);
+        m_publishQueue.pop();
+        ++count;
+
+        if (sendOp != nullptr) {
+            ec = sendOp->config(req.m_config);
+            if (ec == CC_Mqtt311ErrorCode_Success) {
+                ec = sendOp->send(req.m_cb, req.m_cbData);
+            }
+            else {
+                sendOp->cancel();
+            }
+        }
+
+        if ((ec != CC_Mqtt311ErrorCode_Success) && (req.m_cb != nullptr)) {
+            req.m_cb(req.m_cbData, nullptr, queuedPublishStatus(ec));
+        }
+    }
+
+    return count;
+}
+
 void ClientImpl::handle(PublishMsg& msg)
 {
     if (m_sessionState.m_disconnecting) {
@@ -449,22 +1013,37 @@ void ClientImpl::handle(PublishMsg& msg)
     }       
 
     do {
+        using Qos = op::Op::Qos;
+        auto qos = msg.transportField_flags().field_qos().value();
         auto createRecvOp = 
-            [this, &msg]()
+            [this, &msg, qos]()
             {
+                bool filtered = 
+                    m_recvStream.m_active ? 
+                        m_recvStream.m_filtered : 
+                        (!isTopicPrefilterAccepted(msg));
+
+                if (filtered && (qos == Qos::AtMostOnceDelivery)) {
+                    // Nothing to acknowledge, validated and dropped without the op
+                    op::RecvOp::verifyPublish(*this, msg);
+                    return;
+                }
+
+                // The filtered messages are still validated by the op before being dropped
                 auto ptr = m_recvOpsAlloc.alloc(*this);
                 if (!ptr) {
                     errorLog("Failed to allocate handling op for the incoming PUBLISH message, ignoring.");
                     return; 
                 }
 
+                m_trace.opCreate(*ptr);
                 m_ops.push_back(ptr.get());
                 m_recvOps.push_back(std::move(ptr));
+                updateOpsHighWaterMarks();
+                m_recvOps.back()->setTopicFiltered(filtered);
                 msg.dispatch(*m_recvOps.back());
             };
 
-        using Qos = op::Op::Qos;
-        auto qos = msg.transportField_flags().field_qos().value();
         if ((qos == Qos::AtMostOnceDelivery) || 
             (qos == Qos::AtLeastOnceDelivery)) {
             createRecvOp();
@@ -600,6 +1179,7 @@ CC_Mqtt311ErrorCode ClientImpl::sendMessage(const ProtMessage& msg)
         return CC_Mqtt311ErrorCode_BufferOverflow;
     }
 
+    updateOutputBufUsage(len);
     m_buf.resize(len);
     auto writeIter = comms::writeIteratorFor<ProtMessage>(&m_buf[0]);
     auto es = m_frame.write(msg, writeIter, len);
@@ -611,6 +1191,88 @@ CC_Mqtt311ErrorCode ClientImpl::sendMessage(const ProtMessage& msg)
 
     COMMS_ASSERT(m_sendOutputDataCb != nullptr);
     m_sendOutputDataCb(m_sendOutputDataData, &m_buf[0], static_cast<unsigned>(len));
+    m_stats.packetOut(msg.getId(), len);
+    m_trace.msgSent(msg, len);
+
+    for (auto& opPtr : m_keepAliveOps) {
+        opPtr->messageSent();
+    }
+
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+CC_Mqtt311ErrorCode ClientImpl::sendStreamedPublish(
+    const PublishMsg& msg, 
+    unsigned dataLen, 
+    CC_Mqtt311PublishPayloadReadCb cb, 
+    void* cbData)
+{
+    COMMS_ASSERT(msg.field_payload().value().empty());
+    COMMS_ASSERT(cb != nullptr);
+
+    using IdAndFlagsField = ProtFrame::Layer_idAndFlags::Field;
+    using SizeField = ProtFrame::Layer_size::Field;
+
+    auto hdrLen = static_cast<unsigned>(msg.doLength());
+    SizeField sizeField;
+    sizeField.setValue(hdrLen + dataLen);
+    if ((!sizeField.valid()) || (sizeField.value() < dataLen)) {
+        errorLog("Streamed publish payload is too long.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    auto len = IdAndFlagsField::minLength() + sizeField.length() + hdrLen;
+    if (m_buf.max_size() < len) {
+        errorLog("Output buffer overflow.");
+        return CC_Mqtt311ErrorCode_BufferOverflow;
+    }
+
+    // Only the header is serialized, the payload is appended by the application
+    auto& flagsField = msg.transportField_flags();
+    updateOutputBufUsage(len);
+    m_buf.resize(len);
+    m_buf[0] = 
+        static_cast<std::uint8_t>(
+            (cc_mqtt311::MsgId_Publish << 4U) |
+            (flagsField.field_dup().getBitValue_bit() ? 0x8 : 0x0) |
+            (static_cast<unsigned>(flagsField.field_qos().value()) << 1U) |
+            (flagsField.field_retain().getBitValue_bit() ? 0x1 : 0x0));
+
+    auto writeIter = comms::writeIteratorFor<ProtMessage>(&m_buf[IdAndFlagsField::minLength()]);
+    auto es = sizeField.write(writeIter, len - IdAndFlagsField::minLength());
+    if (es == comms::ErrorStatus::Success) {
+        es = msg.doWrite(writeIter, hdrLen);
+    }
+
+    COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    if (es != comms::ErrorStatus::Success) {
+        errorLog("Failed to serialize output message.");
+        return CC_Mqtt311ErrorCode_InternalError;
+    }
+
+    COMMS_ASSERT(m_sendOutputDataCb != nullptr);
+    m_sendOutputDataCb(m_sendOutputDataData, &m_buf[0], static_cast<unsigned>(len));
+
+    auto chunkSize = std::min(static_cast<unsigned>(m_buf.max_size()), ExtConfig::PublishStreamChunkSize);
+    unsigned offset = 0U;
+    while (offset < dataLen) {
+        auto count = std::min(dataLen - offset, chunkSize);
+        updateOutputBufUsage(count);
+        m_buf.resize(count);
+        auto readCount = cb(cbData, offset, &m_buf[0], count);
+        if ((readCount == 0U) || (count < readCount)) {
+            // The message is partially written, the connection cannot be used any more.
+            errorLog("Streamed publish payload is unavailable.");
+            brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_InternalError, CC_Mqtt311AsyncOpStatus_InternalError);
+            return CC_Mqtt311ErrorCode_InternalError;
+        }
+
+        m_sendOutputDataCb(m_sendOutputDataData, &m_buf[0], readCount);
+        offset += readCount;
+    }
+
+    m_stats.packetOut(cc_mqtt311::MsgId_Publish, len + dataLen);
+    m_trace.publishSent(len + dataLen);
 
     for (auto& opPtr : m_keepAliveOps) {
         opPtr->messageSent();
@@ -629,6 +1291,7 @@ void ClientImpl::opComplete(const op::Op* op)
 
     *iter = nullptr;
     m_opsDeleted = true;
+    m_trace.opComplete(*op);
 
     using ExtraCompleteFunc = void (ClientImpl::*)(const op::Op*);
     static const ExtraCompleteFunc Map[] = {
@@ -642,6 +1305,8 @@ void ClientImpl::opComplete(const op::Op* op)
     };
     static const std::size_t MapSize = std::extent<decltype(Map)>::value;
     static_assert(MapSize == op::Op::Type_NumOfValues);
+    static_assert(static_cast<unsigned>(op::Op::Type_NumOfValues) == CC_Mqtt311TraceOpType_ValuesLimit);
+    static_assert(static_cast<unsigned>(op::Op::Type_Send) == CC_Mqtt311TraceOpType_Publish);
 
     auto idx = static_cast<unsigned>(op->type());
     COMMS_ASSERT(idx < MapSize);
@@ -662,42 +1327,42 @@ void ClientImpl::brokerConnected(bool sessionPresent)
     do {
         if (sessionPresent) {
             for (auto& sendOpPtr : m_sendOps) {
-                sendOpPtr->postReconnectionResend();
+                sendOpPtr->prepareReconnectionResend();
             }  
 
             for (auto& recvOpPtr : m_recvOps) {
                 recvOpPtr->postReconnectionResume();
             }    
 
-            auto resumeUntilIdx = m_sendOps.size(); 
-            auto resumeFromIdx = resumeUntilIdx; 
-            for (auto count = resumeUntilIdx; count > 0U; --count) {
-                auto idx = count - 1U;
-                auto& sendOpPtr = m_sendOps[idx];
-                if (!sendOpPtr->isPaused()) {
-                    break;
-                }
-
-                resumeFromIdx = idx;
-            }
-
-            if (resumeFromIdx < resumeUntilIdx) {
-                resumeSendOpsSince(static_cast<unsigned>(resumeFromIdx));
-            }            
-
+            m_sessionState.m_reconnectResendInProgress = true;
+            resumeReconnectionResend();
             break;
         }
 
         // Old stored session, terminate pending ops
         for (auto* op : m_ops) {
+            if (op == nullptr) {
+                continue;
+            }
+
             auto opType = op->type();
             if ((opType != op::Op::Type::Type_Send) && 
                 (opType != op::Op::Type::Type_Recv)) {
                 continue;
             }
 
+            if ((opType == op::Op::Type::Type_Send) && 
+                (static_cast<const op::SendOp*>(op)->isOfflineQueued())) {
+                // Never sent, not part of the old session
+                continue;
+            }
+
             op->terminateOp(CC_Mqtt311AsyncOpStatus_Aborted);
         }
+
+        if (m_clientState.m_offlineQueueMsgs > 0U) {
+            resumeSendOpsSince(0U);
+        }
     } while (false);
 
     createKeepAliveOpIfNeeded();    
@@ -709,8 +1374,10 @@ void ClientImpl::brokerDisconnected(
 {
     m_clientState.m_initialized = false; // Require re-initialization
     m_sessionState.m_connected = false;
+    m_resendPacingTimer.cancel();
 
     m_sessionState.m_disconnecting = true;
+    m_recvStream.m_active = false;
     terminateOps(status, TerminateMode_KeepSendRecvOps);    
 
     for (auto* op : m_ops) {
@@ -727,10 +1394,69 @@ void ClientImpl::brokerDisconnected(
 
 void ClientImpl::reportMsgInfo(const CC_Mqtt311MessageInfo& info)
 {
+    if (m_recvStream.m_active) {
+        // The payload has been reported in fragments, report the final one
+        reportMsgChunk(m_recvStream.m_lastData, m_recvStream.m_lastDataLen, true);
+        return;
+    }
+
+    if (m_lazyRecv.m_active) {
+        // The payload hasn't been copied into the message object
+        auto lazyInfo = info;
+        lazyInfo.m_data = nullptr;
+        lazyInfo.m_dataLen = m_lazyRecv.m_payloadLen;
+        if (m_lazyRecv.m_payloadLen > 0U) {
+            lazyInfo.m_data = m_lazyRecv.m_payload;
+        }
+
+        COMMS_ASSERT(m_messageReceivedReportCb != nullptr);
+        m_messageReceivedReportCb(m_messageReceivedReportData, &lazyInfo);
+        return;
+    }
+
     COMMS_ASSERT(m_messageReceivedReportCb != nullptr);
     m_messageReceivedReportCb(m_messageReceivedReportData, &info);
 }
 
+void ClientImpl::reportSessionStoreRecord(const CC_Mqtt311SessionStoreRecord& record)
+{
+    if (m_sessionStoreCb == nullptr) {
+        return;
+    }
+
+    m_sessionStoreCb(m_sessionStoreData, &record);
+}
+
+bool ClientImpl::offlineQueueAccept(op::SendOp* sendOp)
+{
+    COMMS_ASSERT(sendOp->isOfflineQueued());
+    auto guard = apiEnter();
+    auto& config = m_configState;
+    while (true) {
+        bool msgsLimitExceeded = 
+            (config.m_offlineQueueMaxMsgs > 0U) && 
+            (config.m_offlineQueueMaxMsgs < m_clientState.m_offlineQueueMsgs);
+
+        bool bytesLimitExceeded = 
+            (config.m_offlineQueueMaxBytes > 0U) && 
+            (config.m_offlineQueueMaxBytes < m_clientState.m_offlineQueueBytes);
+
+        if ((!msgsLimitExceeded) && (!bytesLimitExceeded)) {
+            return true;
+        }
+
+        auto* dropOp = offlineQueueDropCandidate(sendOp);
+        COMMS_ASSERT(dropOp != nullptr);
+        if ((dropOp == nullptr) || (dropOp == sendOp)) {
+            errorLog("Offline publish queue is full, rejecting new publish.");
+            return false;
+        }
+
+        errorLog("Offline publish queue is full, dropping queued publish.");
+        dropOp->dropOffline(); // Removes the op from the list
+    }
+}
+
 bool ClientImpl::hasPausedSendsBefore(const op::SendOp* sendOp) const
 {
     auto riter = 
@@ -805,6 +1531,11 @@ void ClientImpl::doApiExit()
 
     cleanOps();
 
+    shrinkOutputBufIfNeeded();
+    if (m_configState.m_leanMode) {
+        releaseIdleMemory();
+    }
+
     if (m_nextTickProgramCb == nullptr) {
         return;
     }
@@ -829,8 +1560,10 @@ void ClientImpl::createKeepAliveOpIfNeeded()
         return;
     }    
 
+    m_trace.opCreate(*ptr);
     m_ops.push_back(ptr.get());
     m_keepAliveOps.push_back(std::move(ptr));
+    updateOpsHighWaterMarks();
 }
 
 void ClientImpl::terminateOps(CC_Mqtt311AsyncOpStatus status, TerminateMode mode)
@@ -870,6 +1603,251 @@ void ClientImpl::cleanOps()
     m_opsDeleted = false;
 }
 
+void ClientImpl::resetInput()
+{
+    m_clientState.m_inputRequiredBytes = 0U;
+    m_inBuf.clear();
+}
+
+void ClientImpl::releaseIdleMemory()
+{
+    // Everything released here is re-allocated on demand, the output buffer
+    // is used only during the send and is always empty by now.
+    m_buf.clear();
+    objListRelease(m_buf);
+    m_inBuf.release();
+
+    objListRelease(m_connectOps);
+    objListRelease(m_keepAliveOps);
+    objListRelease(m_disconnectOps);
+    objListRelease(m_subscribeOps);
+    objListRelease(m_unsubscribeOps);
+    objListRelease(m_recvOps);
+    objListRelease(m_sendOps);
+    objListRelease(m_ops);
+
+    if (!m_recvStream.m_active) {
+        // Drop the retained topic storage of the last received message
+        m_recvPubMsg = PublishMsg();
+    }
+}
+
+void ClientImpl::updateOpsHighWaterMarks()
+{
+    auto& marks = m_clientState.m_highWaterMarks;
+    marks.m_ops = std::max(marks.m_ops, static_cast<unsigned>(m_ops.size()));
+    marks.m_sendOps = std::max(marks.m_sendOps, static_cast<unsigned>(m_sendOps.size()));
+    marks.m_recvOps = std::max(marks.m_recvOps, static_cast<unsigned>(m_recvOps.size()));
+}
+
+void ClientImpl::updateOutputBufUsage(std::size_t len)
+{
+    auto& marks = m_clientState.m_highWaterMarks;
+    marks.m_outputBuf = std::max(marks.m_outputBuf, static_cast<unsigned>(len));
+    if (m_configState.m_outputBufShrinkThreshold < len) {
+        m_clientState.m_outputBufLargeUseTimestamp = m_timerMgr.elapsed();
+    }
+}
+
+void ClientImpl::shrinkOutputBufIfNeeded()
+{
+    if constexpr (objListIsDynamic<OutputBuf>()) {
+        auto threshold = m_configState.m_outputBufShrinkThreshold;
+        if ((threshold == 0U) || (m_buf.capacity() <= threshold)) {
+            return;
+        }
+
+        auto idleMs = m_timerMgr.elapsed() - m_clientState.m_outputBufLargeUseTimestamp;
+        if (idleMs < m_configState.m_outputBufShrinkDecayMs) {
+            return;
+        }
+
+        // The contents are not retained between the sends
+        OutputBuf buf;
+        buf.reserve(threshold);
+        m_buf.swap(buf);
+    }
+}
+
+bool ClientImpl::isTopicPrefilterAccepted(const PublishMsg& msg) const
+{
+    if (m_topicPrefilterCb == nullptr) {
+        return true;
+    }
+
+    auto& topic = msg.field_topic().value();
+    return m_topicPrefilterCb(m_topicPrefilterData, topic.c_str(), static_cast<unsigned>(topic.size()));
+}
+
+bool ClientImpl::isRecvStreamRequired(std::uint8_t idAndFlags, unsigned remLen) const
+{
+    auto threshold = m_configState.m_msgStreamingThreshold;
+    return 
+        (threshold > 0U) &&
+        (m_messageChunkReportCb != nullptr) &&
+        ((idAndFlags >> 4U) == cc_mqtt311::MsgId_Publish) &&
+        (threshold <= remLen);
+}
+
+void ClientImpl::setTransportFlags(ProtMessage& msg, std::uint8_t idAndFlags)
+{
+    using Qos = op::Op::Qos;
+    auto& flagsField = msg.transportField_flags();
+    flagsField.field_retain().setBitValue_bit((idAndFlags & 0x1) != 0U);
+    flagsField.field_qos().setValue(static_cast<Qos>((idAndFlags >> 1U) & 0x3));
+    flagsField.field_dup().setBitValue_bit((idAndFlags & 0x8) != 0U);
+}
+
+comms::ErrorStatus ClientImpl::readPublishVarHeader(std::uint8_t idAndFlags, const std::uint8_t*& iter, unsigned len)
+{
+    // The message object is reused, the topic storage is not reallocated
+    // for every reception.
+    using Qos = op::Op::Qos;
+    auto qos = static_cast<Qos>((idAndFlags >> 1U) & 0x3);
+    if (qos > Qos::ExactlyOnceDelivery) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    auto& msg = m_recvPubMsg;
+    setTransportFlags(msg, idAndFlags);
+    msg.doRefresh(); // Update packetId presence
+
+    auto* topicBegin = iter;
+    auto es = msg.field_topic().read(iter, len);
+    if ((es == comms::ErrorStatus::Success) && 
+        (isFieldArenaExhausted(msg.field_topic(), static_cast<std::size_t>(std::distance(topicBegin, iter))))) {
+        errorLog("Failed to store the incoming topic, the field arena is exhausted");
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    if (es == comms::ErrorStatus::Success) {
+        es = msg.field_packetId().read(iter, len - msg.field_topic().length());
+    }
+
+    return es;
+}
+
+bool ClientImpl::isLazyPublishDecode(std::uint8_t idAndFlags) const
+{
+    return 
+        m_configState.m_lazyPublishDecode &&
+        ((idAndFlags >> 4U) == cc_mqtt311::MsgId_Publish);
+}
+
+comms::ErrorStatus ClientImpl::processLazyPublish(std::uint8_t idAndFlags, const std::uint8_t* iter, unsigned remLen)
+{
+    // The whole packet is available, only the variable header is decoded, 
+    // the payload is reported directly from the input buffer.
+    auto* iterTmp = iter;
+    auto es = readPublishVarHeader(idAndFlags, iterTmp, remLen);
+    if (es != comms::ErrorStatus::Success) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    auto hdrLen = static_cast<unsigned>(std::distance(iter, iterTmp));
+    COMMS_ASSERT(hdrLen <= remLen);
+    m_lazyRecv.m_payload = iterTmp;
+    m_lazyRecv.m_payloadLen = remLen - hdrLen;
+    m_lazyRecv.m_active = true;
+    handle(m_recvPubMsg);
+    m_lazyRecv = LazyRecvState();
+    return comms::ErrorStatus::Success;
+}
+
+comms::ErrorStatus ClientImpl::startRecvStream(std::uint8_t idAndFlags, const std::uint8_t*& iter, unsigned len, unsigned remLen)
+{
+    // Only the variable header is parsed here, the payload is reported in 
+    // fragments by the processRecvStream().
+    m_recvStream = RecvStreamState();
+    auto& msg = m_recvPubMsg;
+    auto* iterTmp = iter;
+    auto es = readPublishVarHeader(idAndFlags, iterTmp, std::min(len, remLen));
+    auto hdrLen = static_cast<unsigned>(std::distance(iter, iterTmp));
+    if ((es == comms::ErrorStatus::NotEnoughData) && (len < remLen)) {
+        return es;
+    }
+
+    if (es != comms::ErrorStatus::Success) {
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+    iter = iterTmp;
+    m_recvStream.m_totalLen = remLen - hdrLen;
+    m_recvStream.m_active = true;
+
+    m_recvStream.m_discard = m_sessionState.m_disconnecting;
+
+    if constexpr (Config::MaxQos >= 2) {
+        using Qos = op::Op::Qos;
+        auto qos = msg.transportField_flags().field_qos().value();
+        if ((!m_recvStream.m_discard) && (qos == Qos::ExactlyOnceDelivery)) {
+            // The duplicate is re-confirmed when complete, no need to report its fragments
+            m_recvStream.m_discard = 
+                std::any_of(
+                    m_recvOps.begin(), m_recvOps.end(),
+                    [&msg](auto& opPtr)
+                    {
+                        return opPtr->packetId() == msg.field_packetId().field().value();
+                    });
+        }
+    }
+
+    if (!m_recvStream.m_discard) {
+        m_recvStream.m_filtered = !isTopicPrefilterAccepted(msg);
+        m_recvStream.m_discard = m_recvStream.m_filtered;
+    }
+
+    if (!m_recvStream.m_discard) {
+        m_recvStream.m_topicId = m_topicIntern.intern(msg.field_topic().value());
+    }
+
+    return comms::ErrorStatus::Success;
+}
+
+unsigned ClientImpl::processRecvStream(const std::uint8_t* iter, unsigned len)
+{
+    COMMS_ASSERT(m_recvStream.m_active);
+    COMMS_ASSERT(m_recvStream.m_offset <= m_recvStream.m_totalLen);
+    auto remaining = m_recvStream.m_totalLen - m_recvStream.m_offset;
+    if (len < remaining) {
+        if ((len > 0U) && (!m_recvStream.m_discard)) {
+            reportMsgChunk(iter, len, false);
+        }
+
+        m_recvStream.m_offset += len;
+        return len;
+    }
+
+    // The last fragment is reported when the message is processed via
+    // the normal path to perform all the relevant validations and 
+    // acknowledgements.
+    m_recvStream.m_lastData = iter;
+    m_recvStream.m_lastDataLen = remaining;
+    handle(m_recvPubMsg);
+    m_recvStream.m_active = false;
+    return remaining;
+}
+
+void ClientImpl::reportMsgChunk(const std::uint8_t* data, unsigned dataLen, bool last)
+{
+    COMMS_ASSERT(m_messageChunkReportCb != nullptr);
+    auto& msg = m_recvPubMsg;
+    auto info = CC_Mqtt311MessageChunkInfo();
+    info.m_topic = msg.field_topic().value().c_str();
+    if (dataLen > 0U) {
+        info.m_data = data;
+    }
+
+    info.m_dataLen = dataLen;
+    info.m_offset = m_recvStream.m_offset;
+    info.m_totalLen = m_recvStream.m_totalLen;
+    comms::cast_assign(info.m_qos) = msg.transportField_flags().field_qos().value();
+    info.m_retained = msg.transportField_flags().field_retain().getBitValue_bit();
+    info.m_last = last;
+    info.m_topicId = m_recvStream.m_topicId;
+    m_messageChunkReportCb(m_messageChunkReportData, &info);
+}
+
 void ClientImpl::errorLogInternal(const char* msg)
 {
     if constexpr (Config::HasErrorLog) {
@@ -914,19 +1892,155 @@ CC_Mqtt311ErrorCode ClientImpl::initInternal()
 
 void ClientImpl::resumeSendOpsSince(unsigned idx)
 {
-    while (idx < m_sendOps.size()) {
-        auto& opToResumePtr = m_sendOps[idx];
-        if (!opToResumePtr->isPaused()) {
+    while (true) {
+        auto* opToResume = nextSendOpToResume(idx);
+        if (opToResume == nullptr) {
+            break;
+        }
+
+        if (!opToResume->resume()) {
+            break;
+        }
+
+        // After resuming some (QoS0) ops can complete right away, search from idx again
+    }
+}
+
+op::SendOp* ClientImpl::nextSendOpToResume(unsigned idx)
+{
+    // Select the first paused op of the highest priority. The strict ordering
+    // is preserved only between the same priority ops.
+    bool fullOrdering = (m_configState.m_publishOrdering == CC_Mqtt311PublishOrdering_Full);
+    auto firstPausedIdx = m_sendOps.size();
+    auto selectedIdx = m_sendOps.size();
+    for (; idx < m_sendOps.size(); ++idx) {
+        auto* sendOp = m_sendOps[idx].get();
+        if (!sendOp->isPaused()) {
+            continue;
+        }
+
+        if (m_sendOps.size() <= firstPausedIdx) {
+            firstPausedIdx = idx;
+            selectedIdx = idx;
+            if (fullOrdering) {
+                break;
+            }
+
+            continue;
+        }
+
+        if (priorityRank(m_sendOps[selectedIdx]->priority()) < priorityRank(sendOp->priority())) {
+            selectedIdx = idx;
+        }
+    }
+
+    if (m_sendOps.size() <= selectedIdx) {
+        return nullptr;
+    }
+
+    if (firstPausedIdx < selectedIdx) {
+        // Keep the list in the order of sending, the acknowledgements are expected in the same order
+        auto firstIter = m_sendOps.begin() + firstPausedIdx;
+        auto selectedIter = m_sendOps.begin() + selectedIdx;
+        std::rotate(firstIter, selectedIter, selectedIter + 1);
+    }
+
+    return m_sendOps[firstPausedIdx].get();
+}
+
+void ClientImpl::resumeReconnectionResend()
+{
+    COMMS_ASSERT(m_sessionState.m_reconnectResendInProgress);
+    auto& config = m_configState;
+    unsigned msgsCount = 0U;
+    std::size_t bytesCount = 0U;
+
+    // Do index controlled iteration because the resend can
+    // cause early message destruction.
+    for (auto idx = 0U; idx < m_sendOps.size();) {
+        auto* sendOp = m_sendOps[idx].get();
+        COMMS_ASSERT(sendOp != nullptr);
+        if (!sendOp->isReconnectionResendPending()) {
             ++idx;
             continue;
-        }         
-        
-        if (!opToResumePtr->resume()) {
+        }
+
+        auto len = sendOp->resendLength();
+        bool msgsLimitReached = 
+            (config.m_resendPacingMaxMsgs > 0U) && 
+            (config.m_resendPacingMaxMsgs <= msgsCount);
+
+        bool bytesLimitReached = 
+            (config.m_resendPacingMaxBytes > 0U) && 
+            (config.m_resendPacingMaxBytes < (bytesCount + len));
+
+        // At least one message is resent in every batch
+        if ((msgsCount > 0U) && (msgsLimitReached || bytesLimitReached)) {
+            m_resendPacingTimer.wait(config.m_resendPacingIntervalMs, &ClientImpl::resendPacingTimeoutCb, this);
+            return;
+        }
+
+        if (m_clientState.m_outputBlocked) {
+            // Continued when the output is writable again
+            return;
+        }
+
+        sendOp->postReconnectionResend(); // can destruct object
+        ++msgsCount;
+        bytesCount += len;
+
+        if ((!m_sessionState.m_connected) || m_sessionState.m_disconnecting) {
+            return;
+        }
+
+        if ((idx < m_sendOps.size()) && (m_sendOps[idx].get() == sendOp)) {
+            ++idx;
+        }
+    }
+
+    m_sessionState.m_reconnectResendInProgress = false;
+
+    auto resumeUntilIdx = m_sendOps.size(); 
+    auto resumeFromIdx = resumeUntilIdx; 
+    for (auto count = resumeUntilIdx; count > 0U; --count) {
+        auto idx = count - 1U;
+        auto& sendOpPtr = m_sendOps[idx];
+        if (!sendOpPtr->isPaused()) {
             break;
         }
 
-        // After resuming some (QoS0) ops can complete right away, increment idx next iteration
+        resumeFromIdx = idx;
     }
+
+    if (resumeFromIdx < resumeUntilIdx) {
+        resumeSendOpsSince(static_cast<unsigned>(resumeFromIdx));
+    }    
+}
+
+op::SendOp* ClientImpl::offlineQueueDropCandidate(op::SendOp* sendOp)
+{
+    auto policy = m_configState.m_offlineQueueDropPolicy;
+    if (policy == CC_Mqtt311OfflineQueueDropPolicy_Newest) {
+        return sendOp;
+    }
+
+    op::SendOp* result = nullptr;
+    for (auto& sendOpPtr : m_sendOps) {
+        if (!sendOpPtr->isOfflineQueued()) {
+            continue;
+        }
+
+        if (policy == CC_Mqtt311OfflineQueueDropPolicy_Oldest) {
+            return sendOpPtr.get();
+        }
+
+        COMMS_ASSERT(policy == CC_Mqtt311OfflineQueueDropPolicy_LowestQos);
+        if ((result == nullptr) || (sendOpPtr->qos() < result->qos())) {
+            result = sendOpPtr.get();
+        }
+    }
+
+    return result;
 }
 
 op::SendOp* ClientImpl::findSendOp(std::uint16_t packetId)
@@ -1055,4 +2169,9 @@ void ClientImpl::opComplete_Send(const op::Op* op)
     resumeSendOpsSince(idx);
 }
 
+void ClientImpl::resendPacingTimeoutCb(void* data)
+{
+    reinterpret_cast<ClientImpl*>(data)->resumeReconnectionResend();
+}
+
 } // namespace cc_mqtt311_client
@@ -8,14 +8,22 @@
 #pragma once
 
 #include "ClientState.h"
+#include "ClientStats.h"
+#include "ClientTrace.h"
 #include "ConfigState.h"
 #include "ExtConfig.h"
+#include "GroupState.h"
+#include "InputBuf.h"
+#include "LatencyHistogram.h"
+#include "MemPool.h"
 #include "ObjAllocator.h"
 #include "ObjListType.h"
 #include "ProtocolDefs.h"
+#include "PublishQueue.h"
 #include "ReuseState.h"
 #include "SessionState.h"
 #include "TimerMgr.h"
+#include "TopicInternTable.h"
 
 #include "op/ConnectOp.h"
 #include "op/DisconnectOp.h"
@@ -64,20 +72,71 @@ public:
     // -------------------- API Calls -----------------------------
     void tick(unsigned ms);
     unsigned processData(const std::uint8_t* iter, unsigned len);
+    unsigned requiredBytes() const
+    {
+        return m_clientState.m_inputRequiredBytes;
+    }
+
+    std::uint8_t* inputBufferAcquire(unsigned& len);
+    unsigned inputBufferCommit(unsigned len);
+
     void notifyNetworkDisconnected();
     bool isNetworkDisconnected() const;
+    void notifyOutputBlocked();
+    void notifyOutputWritable();
+    bool isOutputBlocked() const
+    {
+        return m_clientState.m_outputBlocked;
+    }
 
     op::ConnectOp* connectPrepare(CC_Mqtt311ErrorCode* ec);
     op::DisconnectOp* disconnectPrepare(CC_Mqtt311ErrorCode* ec);
     op::SubscribeOp* subscribePrepare(CC_Mqtt311ErrorCode* ec);
     op::UnsubscribeOp* unsubscribePrepare(CC_Mqtt311ErrorCode* ec);
     op::SendOp* publishPrepare(CC_Mqtt311ErrorCode* ec);
+    CC_Mqtt311ErrorCode publishRestore(const CC_Mqtt311PublishRestoreConfig& config, CC_Mqtt311PublishCompleteCb cb, void* cbData);
 
     CC_Mqtt311ErrorCode setPublishOrdering(CC_Mqtt311PublishOrdering ordering);
     CC_Mqtt311PublishOrdering getPublishOrdering() const
     {
         return m_configState.m_publishOrdering;
     }    
+
+    CC_Mqtt311ErrorCode setResendPacing(const CC_Mqtt311ResendPacingConfig& config);
+    void getResendPacing(CC_Mqtt311ResendPacingConfig& config) const;
+
+    CC_Mqtt311ErrorCode setOfflineQueue(const CC_Mqtt311OfflineQueueConfig& config);
+    void getOfflineQueue(CC_Mqtt311OfflineQueueConfig& config) const;
+    CC_Mqtt311ErrorCode getPriorityStats(CC_Mqtt311PublishPriority priority, CC_Mqtt311PublishPriorityStats& stats) const;
+
+    void setLeanMode(bool value);
+    bool getLeanMode() const
+    {
+        return m_configState.m_leanMode;
+    }
+
+    void getMemoryFootprint(CC_Mqtt311MemoryFootprint& info) const;
+
+    CC_Mqtt311ErrorCode setOutputBufShrink(const CC_Mqtt311OutputBufShrinkConfig& config);
+    void getOutputBufShrink(CC_Mqtt311OutputBufShrinkConfig& config) const;
+    void getHighWaterMarks(CC_Mqtt311HighWaterMarks& marks) const;
+    void resetHighWaterMarks();
+    CC_Mqtt311ErrorCode getStats(CC_Mqtt311ClientStats& stats) const;
+    CC_Mqtt311ErrorCode setLatencyTracking(bool enabled);
+    bool getLatencyTracking() const
+    {
+        return m_latency.isActive();
+    }
+
+    CC_Mqtt311ErrorCode getLatencyStats(CC_Mqtt311LatencyType type, CC_Mqtt311LatencyStats& stats) const;
+    void resetLatencyStats()
+    {
+        m_latency.reset();
+    }
+
+    CC_Mqtt311ErrorCode setTraceCallback(CC_Mqtt311TraceCb cb, void* data);
+    CC_Mqtt311ErrorCode setTraceRingCapacity(unsigned capacity);
+    unsigned traceRingRead(CC_Mqtt311TraceRecord* records, unsigned maxCount);
     
     std::size_t sendsCount() const
     {
@@ -100,6 +159,21 @@ public:
         }
     }
 
+    TickCallbacks replaceTickCallbacks(const TickCallbacks& callbacks)
+    {
+        TickCallbacks prev;
+        prev.m_programCb = m_nextTickProgramCb;
+        prev.m_programData = m_nextTickProgramData;
+        prev.m_cancelCb = m_cancelNextTickWaitCb;
+        prev.m_cancelData = m_cancelNextTickWaitData;
+
+        m_nextTickProgramCb = callbacks.m_programCb;
+        m_nextTickProgramData = callbacks.m_programData;
+        m_cancelNextTickWaitCb = callbacks.m_cancelCb;
+        m_cancelNextTickWaitData = callbacks.m_cancelData;
+        return prev;
+    }
+
     void setSendOutputDataCallback(CC_Mqtt311SendOutputDataCb cb, void* data)
     {
         if (cb != nullptr) {
@@ -124,12 +198,30 @@ public:
         }
     }
 
+    void setMessageChunkReportCallback(CC_Mqtt311MessageChunkReportCb cb, void* data)
+    {
+        m_messageChunkReportCb = cb;
+        m_messageChunkReportData = data;
+    }
+
     void setErrorLogCallback(CC_Mqtt311ErrorLogCb cb, void* data)
     {
         m_errorLogCb = cb;
         m_errorLogData = data;
     }
 
+    void setSessionStoreCallback(CC_Mqtt311SessionStoreCb cb, void* data)
+    {
+        m_sessionStoreCb = cb;
+        m_sessionStoreData = data;
+    }
+
+    void setTopicPrefilterCallback(CC_Mqtt311TopicPrefilterCb cb, void* data)
+    {
+        m_topicPrefilterCb = cb;
+        m_topicPrefilterData = data;
+    }
+
     // -------------------- Message Handling -----------------------------
 
     using Base::handle;
@@ -150,12 +242,25 @@ public:
     // -------------------- Ops Access API -----------------------------
 
     CC_Mqtt311ErrorCode sendMessage(const ProtMessage& msg);
+    CC_Mqtt311ErrorCode sendStreamedPublish(const PublishMsg& msg, unsigned dataLen, CC_Mqtt311PublishPayloadReadCb cb, void* cbData);
+    std::size_t frameLength(const ProtMessage& msg) const
+    {
+        return m_frame.length(msg);
+    }
+
     void opComplete(const op::Op* op);
     void brokerConnected(bool sessionPresent);
     void brokerDisconnected(
         CC_Mqtt311BrokerDisconnectReason reason = CC_Mqtt311BrokerDisconnectReason_ValuesLimit,  
         CC_Mqtt311AsyncOpStatus status = CC_Mqtt311AsyncOpStatus_BrokerDisconnected);
     void reportMsgInfo(const CC_Mqtt311MessageInfo& info);
+    void reportSessionStoreRecord(const CC_Mqtt311SessionStoreRecord& record);
+    bool hasSessionStore() const
+    {
+        return m_sessionStoreCb != nullptr;
+    }
+
+    bool offlineQueueAccept(op::SendOp* sendOp);
     bool hasPausedSendsBefore(const op::SendOp* sendOp) const;
     bool hasHigherQosSendsBefore(const op::SendOp* sendOp, op::Op::Qos qos) const;
     void allowNextPrepare();
@@ -200,6 +305,43 @@ public:
         return m_reuseState;
     }    
 
+    TopicInternTable& topicIntern()
+    {
+        return m_topicIntern;
+    }
+
+    MemPool& memPool()
+    {
+        return m_memPool;
+    }
+
+    GroupState& groupState()
+    {
+        return m_groupState;
+    }
+
+    PublishQueue& publishQueue()
+    {
+        return m_publishQueue;
+    }
+
+    ClientStats& stats()
+    {
+        return m_stats;
+    }
+
+    LatencyTracker& latency()
+    {
+        return m_latency;
+    }
+
+    ClientTrace& trace()
+    {
+        return m_trace;
+    }
+
+    unsigned drainPublishQueue();
+
     inline void errorLog(const char* msg)
     {
         if constexpr (Config::HasErrorLog) {
@@ -238,6 +380,25 @@ private:
     using OpToDeletePtrsList = ObjListType<const op::Op*, ExtConfig::OpsLimit>;
     using OutputBuf = ObjListType<std::uint8_t, ExtConfig::MaxOutputPacketSize>;
 
+    struct RecvStreamState
+    {
+        const std::uint8_t* m_lastData = nullptr;
+        unsigned m_lastDataLen = 0U;
+        unsigned m_offset = 0U;
+        unsigned m_totalLen = 0U;
+        bool m_active = false;
+        bool m_discard = false;
+        unsigned m_topicId = 0U;
+        bool m_filtered = false;
+    };
+
+    struct LazyRecvState
+    {
+        const std::uint8_t* m_payload = nullptr;
+        unsigned m_payloadLen = 0U;
+        bool m_active = false;
+    };
+
     enum TerminateMode
     {
         TerminateMode_KeepSendRecvOps,
@@ -250,9 +411,42 @@ private:
     void createKeepAliveOpIfNeeded();
     void terminateOps(CC_Mqtt311AsyncOpStatus status, TerminateMode mode);
     void cleanOps();
+    void resetInput();
+    void releaseIdleMemory();
+    void updateOpsHighWaterMarks();
+    void updateOutputBufUsage(std::size_t len);
+    void shrinkOutputBufIfNeeded();
+    static void setTransportFlags(ProtMessage& msg, std::uint8_t idAndFlags);
+    comms::ErrorStatus readPublishVarHeader(std::uint8_t idAndFlags, const std::uint8_t*& iter, unsigned len);
+    bool isLazyPublishDecode(std::uint8_t idAndFlags) const;
+    comms::ErrorStatus processLazyPublish(std::uint8_t idAndFlags, const std::uint8_t* iter, unsigned remLen);
+    bool isTopicPrefilterAccepted(const PublishMsg& msg) const;
+    bool isRecvStreamRequired(std::uint8_t idAndFlags, unsigned remLen) const;
+    comms::ErrorStatus startRecvStream(std::uint8_t idAndFlags, const std::uint8_t*& iter, unsigned len, unsigned remLen);
+    unsigned processRecvStream(const std::uint8_t* iter, unsigned len);
+    void reportMsgChunk(const std::uint8_t* data, unsigned dataLen, bool last);
     void errorLogInternal(const char* msg);
     CC_Mqtt311ErrorCode initInternal();
+
+    // The field arena storage is left shorter than the value on the wire when
+    // exhausted, detected by the decoded length being different.
+    template <typename TObj>
+    static bool isFieldArenaExhausted(const TObj& obj, std::size_t wireLen)
+    {
+        if constexpr (Config::FieldArenaSize == 0U) {
+            static_cast<void>(obj);
+            static_cast<void>(wireLen);
+            return false;
+        }
+        else {
+            return obj.length() != wireLen;
+        }
+    }
+
     void resumeSendOpsSince(unsigned idx);
+    op::SendOp* nextSendOpToResume(unsigned idx);
+    void resumeReconnectionResend();
+    op::SendOp* offlineQueueDropCandidate(op::SendOp* sendOp);
     op::SendOp* findSendOp(std::uint16_t packetId);
     bool isLegitSendAck(const op::SendOp* sendOp, bool pubcompAck = false) const;
     void resendAllUntil(op::SendOp* sendOp);
@@ -266,6 +460,8 @@ private:
     void opComplete_Recv(const op::Op* op);
     void opComplete_Send(const op::Op* op);
 
+    static void resendPacingTimeoutCb(void* data);
+
     friend class ApiEnterGuard;
 
     CC_Mqtt311NextTickProgramCb m_nextTickProgramCb = nullptr;
@@ -283,21 +479,38 @@ private:
     CC_Mqtt311MessageReceivedReportCb m_messageReceivedReportCb = nullptr;
     void* m_messageReceivedReportData = nullptr;      
 
+    CC_Mqtt311MessageChunkReportCb m_messageChunkReportCb = nullptr;
+    void* m_messageChunkReportData = nullptr;
+
     CC_Mqtt311ErrorLogCb m_errorLogCb = nullptr;
     void* m_errorLogData = nullptr;
 
+    CC_Mqtt311SessionStoreCb m_sessionStoreCb = nullptr;
+    void* m_sessionStoreData = nullptr;
+    CC_Mqtt311TopicPrefilterCb m_topicPrefilterCb = nullptr;
+    void* m_topicPrefilterData = nullptr;
+
     ConfigState m_configState;
     ClientState m_clientState;
     SessionState m_sessionState;
     ReuseState m_reuseState;
 
     TimerMgr m_timerMgr;
+    TimerMgr::Timer m_resendPacingTimer;
     unsigned m_apiEnterCount = 0U;
 
     OutputBuf m_buf;
+    InputBuf m_inBuf;
 
     ProtFrame m_frame;
 
+    MemPool m_memPool;
+    GroupState m_groupState;
+    PublishQueue m_publishQueue;
+    ClientStats m_stats;
+    LatencyTracker m_latency;
+    ClientTrace m_trace;
+
     ConnectOpAlloc m_connectOpAlloc;
     ConnectOpsList m_connectOps;
 
@@ -319,6 +532,11 @@ private:
     SendOpAlloc m_sendOpsAlloc;
     SendOpsList m_sendOps;
 
+    PublishMsg m_recvPubMsg; // Partially decoded PUBLISH of the streamed and lazy receive paths
+    RecvStreamState m_recvStream;
+    LazyRecvState m_lazyRecv;
+    TopicInternTable m_topicIntern;
+
     OpPtrsList m_ops;
     bool m_opsDeleted = false;
     bool m_preparationLocked = false;
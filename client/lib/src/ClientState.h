@@ -13,6 +13,8 @@
 
 #include "cc_mqtt311_client/common.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace cc_mqtt311_client
@@ -21,14 +23,24 @@ namespace cc_mqtt311_client
 struct ClientState
 {
     using PacketIdsList = ObjListType<std::uint16_t, ExtConfig::PacketIdsLimit>;
+    using PriorityStatsList = std::array<CC_Mqtt311PublishPriorityStats, CC_Mqtt311PublishPriority_ValuesLimit>;
 
     static constexpr unsigned DefaultKeepAlive = 60;
 
     PacketIdsList m_allocatedPacketIds;
     std::uint16_t m_lastPacketId = 0U;
+    unsigned m_offlineQueueMsgs = 0U;
+    std::size_t m_offlineQueueBytes = 0U;
+    PriorityStatsList m_priorityStats = {};
+    unsigned m_inputRequiredBytes = 0U;
+    CC_Mqtt311HighWaterMarks m_highWaterMarks = {}; // The timers are tracked by the TimerMgr
+    std::uint64_t m_outputBufLargeUseTimestamp = 0U;
     bool m_initialized = false;
     bool m_firstConnect = true;
     bool m_networkDisconnected = false;
+    bool m_outputBlocked = false;
+    bool m_inputBufCommitInProgress = false;
+    bool m_inputBufResetPending = false;
 };
 
 } // namespace cc_mqtt311_client
@@ -0,0 +1,94 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Config.h"
+
+#include "cc_mqtt311_client/common.h"
+
+#include <cstddef>
+
+namespace cc_mqtt311_client
+{
+
+// The counters and the code updating them are removed 
+// when the statistics are disabled in the configuration.
+template <bool TEnabled>
+class ClientStatsImpl
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return true;
+    }
+
+    void packetIn(unsigned type, std::size_t len)
+    {
+        if (type < CC_Mqtt311PacketType_ValuesLimit) {
+            ++m_counters.m_packetsIn[type];
+            m_counters.m_bytesIn[type] += len;
+        }
+    }
+
+    void packetOut(unsigned type, std::size_t len)
+    {
+        if (type < CC_Mqtt311PacketType_ValuesLimit) {
+            ++m_counters.m_packetsOut[type];
+            m_counters.m_bytesOut[type] += len;
+        }
+    }
+
+    void dupResend()
+    {
+        ++m_counters.m_dupResends;
+    }
+
+    void timeout()
+    {
+        ++m_counters.m_timeouts;
+    }
+
+    void processData(unsigned consumed)
+    {
+        ++m_counters.m_processDataCalls;
+        m_counters.m_processDataBytes += consumed;
+    }
+
+    void get(CC_Mqtt311ClientStats& stats) const
+    {
+        stats = m_counters;
+    }
+
+private:
+    CC_Mqtt311ClientStats m_counters = {};
+};
+
+template <>
+class ClientStatsImpl<false>
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return false;
+    }
+
+    void packetIn(unsigned, std::size_t) {}
+    void packetOut(unsigned, std::size_t) {}
+    void dupResend() {}
+    void timeout() {}
+    void processData(unsigned) {}
+
+    void get(CC_Mqtt311ClientStats& stats) const
+    {
+        stats = CC_Mqtt311ClientStats();
+    }
+};
+
+using ClientStats = ClientStatsImpl<Config::HasStats>;
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,259 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ExtConfig.h"
+#include "ProtocolDefs.h"
+#include "op/Op.h"
+
+#include "cc_mqtt311_client/common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace cc_mqtt311_client
+{
+
+// Bounded lock-free single-producer single-consumer ring of the tracing
+// records. The records are pushed by the thread owning the client and
+// can be read by any other (single) thread. The records pushed when
+// the ring is full are dropped.
+class TraceRing
+{
+public:
+    static constexpr bool isSupported()
+    {
+        return ExtConfig::HasDynMemAlloc;
+    }
+
+    TraceRing() = default;
+    TraceRing(const TraceRing&) = delete;
+    TraceRing& operator=(const TraceRing&) = delete;
+
+    // Must not be invoked while the records are being read
+    bool setCapacity(unsigned value)
+    {
+        m_records.reset();
+        m_capacity = 0U;
+        m_head.store(0U, std::memory_order_relaxed);
+        m_tail.store(0U, std::memory_order_relaxed);
+
+        if (value == 0U) {
+            return true;
+        }
+
+        m_records.reset(new (std::nothrow) CC_Mqtt311TraceRecord[value]);
+        if (!m_records) {
+            return false;
+        }
+
+        m_capacity = value;
+        return true;
+    }
+
+    void push(const CC_Mqtt311TraceRecord& record)
+    {
+        if (m_capacity == 0U) {
+            return;
+        }
+
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        auto head = m_head.load(std::memory_order_acquire);
+        if (m_capacity <= (tail - head)) {
+            return;
+        }
+
+        m_records[tail % m_capacity] = record;
+        m_tail.store(tail + 1U, std::memory_order_release);
+    }
+
+    unsigned read(CC_Mqtt311TraceRecord* records, unsigned maxCount)
+    {
+        if (m_capacity == 0U) {
+            return 0U;
+        }
+
+        auto head = m_head.load(std::memory_order_relaxed);
+        auto tail = m_tail.load(std::memory_order_acquire);
+        auto count = static_cast<unsigned>(std::min<std::size_t>(tail - head, maxCount));
+        for (auto idx = 0U; idx < count; ++idx) {
+            records[idx] = m_records[(head + idx) % m_capacity];
+        }
+
+        m_head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    unsigned capacity() const
+    {
+        return m_capacity;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return m_capacity * sizeof(CC_Mqtt311TraceRecord);
+    }
+
+private:
+    std::unique_ptr<CC_Mqtt311TraceRecord[]> m_records;
+    unsigned m_capacity = 0U;
+    std::atomic<std::size_t> m_tail{0U};
+    alignas(64) std::atomic<std::size_t> m_head{0U}; // Avoid sharing the cache line with the producer data
+};
+
+// The tracing points are compiled out completely unless enabled in the configuration.
+template <bool TEnabled>
+class ClientTraceImpl
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return true;
+    }
+
+    void setCallback(CC_Mqtt311TraceCb cb, void* data)
+    {
+        m_cb = cb;
+        m_cbData = data;
+    }
+
+    TraceRing& ring()
+    {
+        return m_ring;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return m_ring.heapBytes();
+    }
+
+    // Updated by the timers manager on every tick
+    void setTimestamp(std::uint64_t value)
+    {
+        m_timestamp = value;
+    }
+
+    void processDataEnter(unsigned len)
+    {
+        report(CC_Mqtt311TraceEvent_ProcessDataEnter, len);
+    }
+
+    void processDataExit(unsigned consumed)
+    {
+        report(CC_Mqtt311TraceEvent_ProcessDataExit, consumed);
+    }
+
+    void msgDispatch(const ProtMessage& msg, std::size_t len)
+    {
+        report(CC_Mqtt311TraceEvent_MsgDispatch, msg.getId(), static_cast<unsigned>(len));
+    }
+
+    // The PUBLISH is not decoded into the message object on the fast paths
+    void publishDispatch(std::size_t len)
+    {
+        report(CC_Mqtt311TraceEvent_MsgDispatch, cc_mqtt311::MsgId_Publish, static_cast<unsigned>(len));
+    }
+
+    void msgSent(const ProtMessage& msg, std::size_t len)
+    {
+        report(CC_Mqtt311TraceEvent_MsgSent, msg.getId(), static_cast<unsigned>(len));
+    }
+
+    void publishSent(std::size_t len)
+    {
+        report(CC_Mqtt311TraceEvent_MsgSent, cc_mqtt311::MsgId_Publish, static_cast<unsigned>(len));
+    }
+
+    void opCreate(const op::Op& op)
+    {
+        report(CC_Mqtt311TraceEvent_OpCreate, op.type());
+    }
+
+    void opComplete(const op::Op& op)
+    {
+        report(CC_Mqtt311TraceEvent_OpComplete, op.type());
+    }
+
+    void timerFire(unsigned idx)
+    {
+        report(CC_Mqtt311TraceEvent_TimerFire, idx);
+    }
+
+    void reconnectResend(unsigned packetId)
+    {
+        report(CC_Mqtt311TraceEvent_ReconnectResend, packetId);
+    }
+
+private:
+    void report(CC_Mqtt311TraceEvent event, unsigned arg1, unsigned arg2 = 0U)
+    {
+        if ((m_cb == nullptr) && (m_ring.capacity() == 0U)) {
+            return;
+        }
+
+        CC_Mqtt311TraceRecord record;
+        record.m_timestampMs = m_timestamp;
+        record.m_event = event;
+        record.m_arg1 = arg1;
+        record.m_arg2 = arg2;
+
+        m_ring.push(record);
+        if (m_cb != nullptr) {
+            m_cb(m_cbData, &record);
+        }
+    }
+
+    CC_Mqtt311TraceCb m_cb = nullptr;
+    void* m_cbData = nullptr;
+    std::uint64_t m_timestamp = 0U;
+    TraceRing m_ring;
+};
+
+template <>
+class ClientTraceImpl<false>
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return false;
+    }
+
+    void setCallback(CC_Mqtt311TraceCb, void*) {}
+
+    // Never used when disabled, exists to keep the calls compilable
+    TraceRing& ring()
+    {
+        static TraceRing Ring;
+        return Ring;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return 0U;
+    }
+
+    void setTimestamp(std::uint64_t) {}
+    void processDataEnter(unsigned) {}
+    void processDataExit(unsigned) {}
+    void msgDispatch(const ProtMessage&, std::size_t) {}
+    void publishDispatch(std::size_t) {}
+    void msgSent(const ProtMessage&, std::size_t) {}
+    void publishSent(std::size_t) {}
+    void opCreate(const op::Op&) {}
+    void opComplete(const op::Op&) {}
+    void timerFire(unsigned) {}
+    void reconnectResend(unsigned) {}
+};
+
+using ClientTrace = ClientTraceImpl<ExtConfig::HasTrace>;
+
+} // namespace cc_mqtt311_client
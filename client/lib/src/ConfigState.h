@@ -15,11 +15,24 @@ namespace cc_mqtt311_client
 struct ConfigState
 {
     static constexpr unsigned DefaultResponseTimeoutMs = 2000;
+    static constexpr unsigned DefaultResendPacingIntervalMs = 100;
     unsigned m_responseTimeoutMs = DefaultResponseTimeoutMs;
+    unsigned m_resendPacingMaxMsgs = 0U;
+    unsigned m_resendPacingMaxBytes = 0U;
+    unsigned m_resendPacingIntervalMs = DefaultResendPacingIntervalMs;
+    unsigned m_offlineQueueMaxMsgs = 0U;
+    unsigned m_offlineQueueMaxBytes = 0U;
+    unsigned m_msgStreamingThreshold = 0U;
+    unsigned m_outputBufShrinkThreshold = 0U;
+    unsigned m_outputBufShrinkDecayMs = 0U;
+    CC_Mqtt311OfflineQueueDropPolicy m_offlineQueueDropPolicy = CC_Mqtt311OfflineQueueDropPolicy_Oldest;
     CC_Mqtt311PublishOrdering m_publishOrdering = CC_Mqtt311PublishOrdering_SameQos;
     bool m_verifyOutgoingTopic = Config::HasTopicFormatVerification;
     bool m_verifyIncomingTopic = Config::HasTopicFormatVerification;
     bool m_verifySubFilter = Config::HasSubTopicVerification;
+    bool m_offlineQueueEnabled = false;
+    bool m_lazyPublishDecode = true;
+    bool m_leanMode = false;
 };
 
 } // namespace cc_mqtt311_client
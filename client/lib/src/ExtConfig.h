@@ -28,6 +28,8 @@ struct ExtConfig : public Config
     static constexpr unsigned RecvOpTimers = 1U;
     static constexpr unsigned SendOpsLimit = SendMaxLimit == 0U ? 0U : SendMaxLimit + 1U;
     static constexpr unsigned SendOpTimers = 1U;    
+    static constexpr unsigned ClientTimers = 1U;
+    static constexpr unsigned PublishStreamChunkSize = MaxOutputPacketSize == 0U ? 4096U : MaxOutputPacketSize;
     static constexpr bool HasOpsLimit = 
         (ConnectOpsLimit > 0U) && 
         (KeepAliveOpsLimit > 0U) &&
@@ -43,7 +45,8 @@ struct ExtConfig : public Config
         (SubscribeOpsLimit * SubscribeOpTimers) +
         (UnsubscribeOpsLimit * UnsubscribeOpTimers) + 
         (RecvOpsLimit * RecvOpTimers) + 
-        (SendOpsLimit * SendOpTimers);
+        (SendOpsLimit * SendOpTimers) + 
+        ClientTimers;
     static constexpr unsigned TimersLimit = HasOpsLimit ? MaxTimersLimit : 0U;
 
     static const unsigned MaxOpsLimit = 
@@ -0,0 +1,136 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "FieldArena.h"
+
+#include "comms/Assert.h"
+
+#include <atomic>
+
+namespace cc_mqtt311_client
+{
+
+namespace
+{
+
+struct BlockHdr
+{
+    std::uint32_t m_size = 0U; // Including the header
+    std::uint32_t m_used = 0U;
+};
+
+constexpr std::size_t BlockAlign = sizeof(BlockHdr);
+constexpr std::size_t PoolSize = (FieldArena::Size / BlockAlign) * BlockAlign;
+constexpr std::size_t PoolStorageSize = PoolSize > 0U ? PoolSize : BlockAlign;
+
+alignas(BlockAlign) std::uint8_t Pool[PoolStorageSize] = {0};
+
+// The pool is shared by all the clients, which can be driven by different threads.
+// The critical sections are short and bounded by the amount of blocks,
+// the spin lock doesn't require any OS support.
+std::atomic_flag PoolLock = ATOMIC_FLAG_INIT;
+
+class PoolLockGuard
+{
+public:
+    PoolLockGuard()
+    {
+        while (PoolLock.test_and_set(std::memory_order_acquire)) {}
+    }
+
+    ~PoolLockGuard()
+    {
+        PoolLock.clear(std::memory_order_release);
+    }
+
+    PoolLockGuard(const PoolLockGuard&) = delete;
+    PoolLockGuard& operator=(const PoolLockGuard&) = delete;
+};
+
+BlockHdr* blockAt(std::size_t pos)
+{
+    return reinterpret_cast<BlockHdr*>(&Pool[pos]);
+}
+
+void ensureInitialized()
+{
+    auto* first = blockAt(0U);
+    if (first->m_size == 0U) {
+        // Zero initialized static storage, the whole pool is a single free block
+        first->m_size = static_cast<std::uint32_t>(PoolSize);
+        first->m_used = 0U;
+    }
+}
+
+void mergeFollowingFree(std::size_t pos)
+{
+    auto* hdr = blockAt(pos);
+    while ((pos + hdr->m_size) < PoolSize) {
+        auto* next = blockAt(pos + hdr->m_size);
+        if (next->m_used != 0U) {
+            break;
+        }
+
+        hdr->m_size += next->m_size;
+    }
+}
+
+} // namespace
+
+void* FieldArena::alloc(std::size_t size)
+{
+    if ((size == 0U) || (PoolSize <= size)) {
+        return nullptr;
+    }
+
+    PoolLockGuard guard;
+    ensureInitialized();
+    auto required = ((size + sizeof(BlockHdr) + BlockAlign - 1U) / BlockAlign) * BlockAlign;
+    std::size_t pos = 0U;
+    while (pos < PoolSize) {
+        auto* hdr = blockAt(pos);
+        COMMS_ASSERT(0U < hdr->m_size);
+        if (hdr->m_used == 0U) {
+            // Coalescing of released blocks is deferred until the next allocation
+            mergeFollowingFree(pos);
+        }
+
+        if ((hdr->m_used != 0U) || (hdr->m_size < required)) {
+            pos += hdr->m_size;
+            continue;
+        }
+
+        auto remSize = hdr->m_size - required;
+        if (sizeof(BlockHdr) < remSize) {
+            auto* rem = blockAt(pos + required);
+            rem->m_size = static_cast<std::uint32_t>(remSize);
+            rem->m_used = 0U;
+            hdr->m_size = static_cast<std::uint32_t>(required);
+        }
+
+        hdr->m_used = 1U;
+        return hdr + 1;
+    }
+
+    return nullptr;
+}
+
+void FieldArena::release(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    PoolLockGuard guard;
+    auto* hdr = reinterpret_cast<BlockHdr*>(ptr) - 1;
+    COMMS_ASSERT(reinterpret_cast<std::uint8_t*>(hdr) >= &Pool[0]);
+    COMMS_ASSERT(reinterpret_cast<std::uint8_t*>(hdr) < &Pool[PoolSize]);
+    COMMS_ASSERT(hdr->m_used != 0U);
+    hdr->m_used = 0U;
+}
+
+} // namespace cc_mqtt311_client
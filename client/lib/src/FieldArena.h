@@ -0,0 +1,388 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace cc_mqtt311_client
+{
+
+// Fixed budget byte pool shared by the variable length protocol fields
+// of all the clients when CC_MQTT311_CLIENT_FIELD_ARENA_SIZE is set.
+// The access is serialized internally.
+class FieldArena
+{
+public:
+    static constexpr std::size_t Size = Config::FieldArenaSize;
+
+    static void* alloc(std::size_t size);
+    static void release(void* ptr);
+};
+
+// Storage type passed to the protocol fields via the
+// comms::option::app::CustomStorageType option. Exposes the subset of the
+// std::string / std::vector interface used by the COMMS library and the client.
+// When the arena is exhausted the modifying operations leave the
+// storage shorter than requested (the copy is left empty), the callers
+// are expected to check the size.
+template <typename T>
+class FieldArenaStorage
+{
+    static constexpr bool IsString = std::is_same<T, char>::value;
+    static constexpr std::size_t TermSize = IsString ? 1U : 0U;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    FieldArenaStorage() = default;
+
+    FieldArenaStorage(const FieldArenaStorage& other)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    FieldArenaStorage(FieldArenaStorage&& other) noexcept :
+        m_data(other.m_data),
+        m_size(other.m_size),
+        m_capacity(other.m_capacity)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0U;
+        other.m_capacity = 0U;
+    }
+
+    FieldArenaStorage(const T* str)
+    {
+        assign(str);
+    }
+
+    ~FieldArenaStorage()
+    {
+        FieldArena::release(m_data);
+    }
+
+    FieldArenaStorage& operator=(const FieldArenaStorage& other)
+    {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    FieldArenaStorage& operator=(FieldArenaStorage&& other) noexcept
+    {
+        if (this != &other) {
+            FieldArena::release(m_data);
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = nullptr;
+            other.m_size = 0U;
+            other.m_capacity = 0U;
+        }
+        return *this;
+    }
+
+    FieldArenaStorage& operator=(const T* str)
+    {
+        assign(str);
+        return *this;
+    }
+
+    template <typename TIter>
+    void assign(TIter first, TIter last)
+    {
+        auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (m_capacity < count) {
+            // Exact fit, the growth is not expected after the assignment
+            clear();
+            if (!reallocate(count)) {
+                return;
+            }
+        }
+
+        std::copy(first, last, m_data);
+        m_size = count;
+        terminate();
+    }
+
+    void assign(const T* str)
+    {
+        static_assert(IsString, "Applicable only to strings");
+        if (str == nullptr) {
+            clear();
+            return;
+        }
+        assign(str, str + std::strlen(str));
+    }
+
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    size_type length() const
+    {
+        return m_size;
+    }
+
+    size_type capacity() const
+    {
+        return m_capacity;
+    }
+
+    static constexpr size_type max_size()
+    {
+        return FieldArena::Size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0U;
+    }
+
+    T* data()
+    {
+        return m_data;
+    }
+
+    const T* data() const
+    {
+        return m_data;
+    }
+
+    const T* c_str() const
+    {
+        static_assert(IsString, "Applicable only to strings");
+        if (m_data == nullptr) {
+            return "";
+        }
+        return m_data;
+    }
+
+    iterator begin()
+    {
+        return m_data;
+    }
+
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+
+    const_iterator cbegin() const
+    {
+        return m_data;
+    }
+
+    iterator end()
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator cend() const
+    {
+        return m_data + m_size;
+    }
+
+    reference operator[](size_type idx)
+    {
+        return m_data[idx];
+    }
+
+    const_reference operator[](size_type idx) const
+    {
+        return m_data[idx];
+    }
+
+    reference front()
+    {
+        return m_data[0];
+    }
+
+    const_reference front() const
+    {
+        return m_data[0];
+    }
+
+    reference back()
+    {
+        return m_data[m_size - 1U];
+    }
+
+    const_reference back() const
+    {
+        return m_data[m_size - 1U];
+    }
+
+    // Returns the storage to the arena
+    void clear()
+    {
+        FieldArena::release(m_data);
+        m_data = nullptr;
+        m_size = 0U;
+        m_capacity = 0U;
+    }
+
+    void reserve(size_type count)
+    {
+        if (m_capacity < count) {
+            reallocate(count);
+        }
+    }
+
+    void resize(size_type count, T value = T())
+    {
+        if ((m_capacity < count) && (!reallocate(count))) {
+            return;
+        }
+
+        if (m_size < count) {
+            std::fill(m_data + m_size, m_data + count, value);
+        }
+
+        m_size = count;
+        terminate();
+    }
+
+    void push_back(T value)
+    {
+        if ((m_capacity <= m_size) && (!reallocate(std::max<size_type>(m_capacity * 2U, MinGrowth)))) {
+            return;
+        }
+
+        m_data[m_size] = value;
+        ++m_size;
+        terminate();
+    }
+
+    void pop_back()
+    {
+        --m_size;
+        terminate();
+    }
+
+    int compare(const T* str, size_type len) const
+    {
+        auto cmpLen = std::min(m_size, len);
+        if (0U < cmpLen) {
+            auto result = std::memcmp(m_data, str, cmpLen * sizeof(T));
+            if (result != 0) {
+                return result;
+            }
+        }
+
+        if (m_size == len) {
+            return 0;
+        }
+
+        return m_size < len ? -1 : 1;
+    }
+
+    int compare(const FieldArenaStorage& other) const
+    {
+        return compare(other.data(), other.size());
+    }
+
+    int compare(const T* str) const
+    {
+        static_assert(IsString, "Applicable only to strings");
+        return compare(str, std::strlen(str));
+    }
+
+private:
+    static constexpr size_type MinGrowth = 8U;
+
+    bool reallocate(size_type count)
+    {
+        auto* newData = static_cast<T*>(FieldArena::alloc((count + TermSize) * sizeof(T)));
+        if (newData == nullptr) {
+            return false;
+        }
+
+        if (0U < m_size) {
+            std::copy(m_data, m_data + m_size, newData);
+        }
+
+        FieldArena::release(m_data);
+        m_data = newData;
+        m_capacity = count;
+        return true;
+    }
+
+    void terminate()
+    {
+        if constexpr (IsString) {
+            if (m_data != nullptr) {
+                m_data[m_size] = '\0';
+            }
+        }
+    }
+
+    T* m_data = nullptr;
+    size_type m_size = 0U;
+    size_type m_capacity = 0U;
+};
+
+template <typename T>
+bool operator==(const FieldArenaStorage<T>& first, const FieldArenaStorage<T>& second)
+{
+    return first.compare(second) == 0;
+}
+
+template <typename T>
+bool operator!=(const FieldArenaStorage<T>& first, const FieldArenaStorage<T>& second)
+{
+    return !(first == second);
+}
+
+template <typename T>
+bool operator<(const FieldArenaStorage<T>& first, const FieldArenaStorage<T>& second)
+{
+    return first.compare(second) < 0;
+}
+
+inline bool operator==(const FieldArenaStorage<char>& first, const char* second)
+{
+    return first.compare(second) == 0;
+}
+
+inline bool operator!=(const FieldArenaStorage<char>& first, const char* second)
+{
+    return !(first == second);
+}
+
+inline bool operator<(const FieldArenaStorage<char>& first, const char* second)
+{
+    return first.compare(second) < 0;
+}
+
+using FieldArenaString = FieldArenaStorage<char>;
+using FieldArenaData = FieldArenaStorage<std::uint8_t>;
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,37 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "cc_mqtt311_client/common.h"
+
+#include <cstdint>
+
+namespace cc_mqtt311_client
+{
+
+class ClientGroup;
+
+struct TickCallbacks
+{
+    CC_Mqtt311NextTickProgramCb m_programCb = nullptr;
+    void* m_programData = nullptr;
+    CC_Mqtt311CancelNextTickWaitCb m_cancelCb = nullptr;
+    void* m_cancelData = nullptr;
+};
+
+struct GroupState
+{
+    ClientGroup* m_group = nullptr;
+    TickCallbacks m_appCallbacks; // Restored when the client leaves the group
+    std::uint64_t m_programmedAt = 0U;
+    std::uint64_t m_deadline = 0U;
+    unsigned m_heapPos = 0U; // Index in the group deadlines heap + 1, 0 when not scheduled
+    bool m_programmed = false;
+};
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,94 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "InputBuf.h"
+
+#include "comms/Assert.h"
+
+#include <algorithm>
+
+namespace cc_mqtt311_client
+{
+
+std::uint8_t* InputBuf::acquire(unsigned required, unsigned& len)
+{
+    if (m_data.empty()) {
+        m_data.resize(Capacity);
+    }
+
+    if (m_readPos == m_writePos) {
+        // Everything has been consumed, start from the beginning
+        m_readPos = 0U;
+        m_writePos = 0U;
+    }
+
+    auto needed = std::max(required, 1U);
+    auto avail = static_cast<unsigned>(m_data.size()) - m_writePos;
+    if ((avail < needed) && (0U < m_readPos)) {
+        // Wrap around, only the incomplete packet is retained
+        std::copy(m_data.begin() + m_readPos, m_data.begin() + m_writePos, m_data.begin());
+        m_writePos -= m_readPos;
+        m_readPos = 0U;
+        avail = static_cast<unsigned>(m_data.size()) - m_writePos;
+    }
+
+    if constexpr (ExtConfig::InputBufferSize == 0U) {
+        if (avail < needed) {
+            m_data.resize(m_writePos + needed);
+            avail = needed;
+        }
+    }
+
+    len = avail;
+    if (avail == 0U) {
+        return nullptr;
+    }
+
+    m_acquired = true;
+    return &m_data[m_writePos];
+}
+
+void InputBuf::commit(unsigned len)
+{
+    m_acquired = false;
+    COMMS_ASSERT(m_writePos + len <= m_data.size());
+    m_writePos += std::min(len, static_cast<unsigned>(m_data.size()) - m_writePos);
+}
+
+void InputBuf::consume(unsigned len)
+{
+    COMMS_ASSERT(len <= size());
+    m_readPos += std::min(len, size());
+}
+
+void InputBuf::clear()
+{
+    if (m_acquired) {
+        // The following commit appends to the region being written into
+        m_readPos = m_writePos;
+        return;
+    }
+
+    m_readPos = 0U;
+    m_writePos = 0U;
+}
+
+void InputBuf::release()
+{
+    if constexpr (objListIsDynamic<StorageType>()) {
+        if (m_acquired || (m_readPos != m_writePos)) {
+            // The region being written into and the incomplete packet are retained
+            return;
+        }
+
+        clear();
+        m_data.clear();
+        objListRelease(m_data);
+    }
+}
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,54 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ExtConfig.h"
+#include "ObjListType.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cc_mqtt311_client
+{
+
+class InputBuf
+{
+public:
+    std::uint8_t* acquire(unsigned required, unsigned& len);
+    void commit(unsigned len);
+    void consume(unsigned len);
+    void clear();
+    void release();
+
+    const std::uint8_t* data() const
+    {
+        return m_data.data() + m_readPos;
+    }
+
+    unsigned size() const
+    {
+        return m_writePos - m_readPos;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return objListHeapBytes(m_data);
+    }
+
+private:
+    using StorageType = ObjListType<std::uint8_t, ExtConfig::InputBufferSize>;
+    static constexpr unsigned DefaultCapacity = 4096U;
+    static constexpr unsigned Capacity = ExtConfig::InputBufferSize > 0U ? ExtConfig::InputBufferSize : DefaultCapacity;
+
+    StorageType m_data;
+    unsigned m_readPos = 0U;
+    unsigned m_writePos = 0U;
+    bool m_acquired = false; // The region returned by acquire() is still owned by the application
+};
+
+} // namespace cc_mqtt311_client
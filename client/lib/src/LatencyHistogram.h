@@ -0,0 +1,305 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Config.h"
+
+#include "cc_mqtt311_client/common.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace cc_mqtt311_client
+{
+
+// Log-bucketed histogram of the millisecond values. The values below 16ms
+// are counted exactly, every power of 2 range above it is split into 8
+// linear sub-buckets, i.e. the reported percentiles are within 12.5%
+// of the real value.
+class LatencyHistogram
+{
+public:
+    void record(std::uint64_t value)
+    {
+        auto valueTmp = static_cast<unsigned>(std::min<std::uint64_t>(value, MaxValue));
+        ++m_buckets[bucketIdx(valueTmp)];
+
+        if (m_count == 0U) {
+            m_min = valueTmp;
+            m_max = valueTmp;
+        }
+        else {
+            m_min = std::min(m_min, valueTmp);
+            m_max = std::max(m_max, valueTmp);
+        }
+
+        ++m_count;
+        m_sum += valueTmp;
+    }
+
+    void get(CC_Mqtt311LatencyStats& stats) const
+    {
+        stats = CC_Mqtt311LatencyStats();
+        if (m_count == 0U) {
+            return;
+        }
+
+        stats.m_count = m_count;
+        stats.m_sumMs = m_sum;
+        stats.m_minMs = m_min;
+        stats.m_maxMs = m_max;
+        stats.m_p50Ms = percentile(500U);
+        stats.m_p90Ms = percentile(900U);
+        stats.m_p99Ms = percentile(990U);
+        stats.m_p999Ms = percentile(999U);
+    }
+
+private:
+    static constexpr unsigned ExactLimit = 16U;
+    static constexpr unsigned SubBucketsShift = 3U;
+    static constexpr unsigned SubBuckets = 1U << SubBucketsShift;
+    static constexpr unsigned MaxValue = 0xffffffffU;
+    static constexpr unsigned BucketsCount = ExactLimit + ((32U - 4U) * SubBuckets);
+
+    static unsigned msbIdx(unsigned value)
+    {
+        auto result = 0U;
+        while (value > 1U) {
+            value >>= 1U;
+            ++result;
+        }
+        return result;
+    }
+
+    static unsigned bucketIdx(unsigned value)
+    {
+        if (value < ExactLimit) {
+            return value;
+        }
+
+        auto msb = msbIdx(value);
+        auto shift = msb - SubBucketsShift;
+        return ExactLimit + ((msb - 4U) * SubBuckets) + ((value >> shift) - SubBuckets);
+    }
+
+    // Highest value counted by the bucket
+    static unsigned bucketMax(unsigned idx)
+    {
+        if (idx < ExactLimit) {
+            return idx;
+        }
+
+        auto rel = idx - ExactLimit;
+        auto msb = (rel / SubBuckets) + 4U;
+        auto shift = msb - SubBucketsShift;
+        auto low = static_cast<std::uint64_t>((rel % SubBuckets) + SubBuckets) << shift;
+        auto high = low + (std::uint64_t(1U) << shift) - 1U;
+        return static_cast<unsigned>(std::min<std::uint64_t>(high, MaxValue));
+    }
+
+    // Permille of the recorded values
+    unsigned percentile(unsigned permille) const
+    {
+        auto threshold = ((static_cast<std::uint64_t>(m_count) * permille) + 999U) / 1000U;
+        std::uint64_t total = 0U;
+        for (auto idx = 0U; idx < m_buckets.size(); ++idx) {
+            total += m_buckets[idx];
+            if (threshold <= total) {
+                // Don't report beyond the really measured range
+                return std::max(m_min, std::min(bucketMax(idx), m_max));
+            }
+        }
+
+        return m_max;
+    }
+
+    std::array<std::uint32_t, BucketsCount> m_buckets = {};
+    unsigned long long m_sum = 0U;
+    unsigned m_count = 0U;
+    unsigned m_min = 0U;
+    unsigned m_max = 0U;
+};
+
+using LatencyHistograms = std::array<LatencyHistogram, CC_Mqtt311LatencyType_ValuesLimit>;
+
+// The histograms are allocated on the heap only when the tracking is enabled.
+template <bool THasDynMemAlloc>
+class LatencyHistogramsStorage
+{
+public:
+    LatencyHistograms* alloc()
+    {
+        if (!m_data) {
+            m_data.reset(new (std::nothrow) LatencyHistograms);
+        }
+        return m_data.get();
+    }
+
+    void release()
+    {
+        m_data.reset();
+    }
+
+    LatencyHistograms* get() const
+    {
+        return m_data.get();
+    }
+
+    std::size_t heapBytes() const
+    {
+        if (!m_data) {
+            return 0U;
+        }
+
+        return sizeof(LatencyHistograms);
+    }
+
+private:
+    std::unique_ptr<LatencyHistograms> m_data;
+};
+
+template <>
+class LatencyHistogramsStorage<false>
+{
+public:
+    LatencyHistograms* alloc()
+    {
+        m_active = true;
+        return &m_data;
+    }
+
+    void release()
+    {
+        m_active = false;
+        m_data = LatencyHistograms();
+    }
+
+    LatencyHistograms* get() const
+    {
+        if (!m_active) {
+            return nullptr;
+        }
+
+        return &m_data;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return 0U;
+    }
+
+private:
+    mutable LatencyHistograms m_data;
+    bool m_active = false;
+};
+
+// The tracking is enabled at runtime and removed completely 
+// when the statistics are disabled in the configuration.
+template <bool TEnabled>
+class LatencyTrackerImpl
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return true;
+    }
+
+    bool setEnabled(bool value)
+    {
+        if (!value) {
+            m_storage.release();
+            return true;
+        }
+
+        return m_storage.alloc() != nullptr;
+    }
+
+    bool isActive() const
+    {
+        return m_storage.get() != nullptr;
+    }
+
+    void record(CC_Mqtt311LatencyType type, std::uint64_t value)
+    {
+        auto* histograms = m_storage.get();
+        if ((histograms == nullptr) || (CC_Mqtt311LatencyType_ValuesLimit <= type)) {
+            return;
+        }
+
+        (*histograms)[type].record(value);
+    }
+
+    void get(CC_Mqtt311LatencyType type, CC_Mqtt311LatencyStats& stats) const
+    {
+        auto* histograms = m_storage.get();
+        if (histograms == nullptr) {
+            stats = CC_Mqtt311LatencyStats();
+            return;
+        }
+
+        (*histograms)[type].get(stats);
+    }
+
+    void reset()
+    {
+        auto* histograms = m_storage.get();
+        if (histograms != nullptr) {
+            *histograms = LatencyHistograms();
+        }
+    }
+
+    std::size_t heapBytes() const
+    {
+        return m_storage.heapBytes();
+    }
+
+private:
+    LatencyHistogramsStorage<Config::HasDynMemAlloc> m_storage;
+};
+
+template <>
+class LatencyTrackerImpl<false>
+{
+public:
+    static constexpr bool isEnabled()
+    {
+        return false;
+    }
+
+    bool setEnabled(bool)
+    {
+        return false;
+    }
+
+    bool isActive() const
+    {
+        return false;
+    }
+
+    void record(CC_Mqtt311LatencyType, std::uint64_t) {}
+
+    void get(CC_Mqtt311LatencyType, CC_Mqtt311LatencyStats& stats) const
+    {
+        stats = CC_Mqtt311LatencyStats();
+    }
+
+    void reset() {}
+
+    std::size_t heapBytes() const
+    {
+        return 0U;
+    }
+};
+
+using LatencyTracker = LatencyTrackerImpl<Config::HasStats>;
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,133 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "MemPool.h"
+
+#include <algorithm>
+#include <new>
+
+namespace cc_mqtt311_client
+{
+
+MemPool::~MemPool()
+{
+    while (m_chunks != nullptr) {
+        auto* next = m_chunks->m_next;
+        freeDirect(m_chunks);
+        m_chunks = next;
+    }
+}
+
+void* MemPool::alloc(std::size_t size)
+{
+    auto idx = classIdx(size);
+    if (ClassesCount <= idx) {
+        return allocDirect(size);
+    }
+
+    auto*& head = m_freeLists[idx];
+    if (head != nullptr) {
+        auto* node = head;
+        head = node->m_next;
+        return node;
+    }
+
+    auto blockSize = classSize(idx);
+    if ((m_chunkRem < blockSize) && (!allocChunk(blockSize))) {
+        return nullptr;
+    }
+
+    auto* result = m_chunkPos;
+    m_chunkPos += blockSize;
+    m_chunkRem -= blockSize;
+    return result;
+}
+
+void MemPool::free(void* ptr, std::size_t size)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto idx = classIdx(size);
+    if (ClassesCount <= idx) {
+        freeDirect(ptr);
+        return;
+    }
+
+    auto* node = new (ptr) FreeNode;
+    node->m_next = m_freeLists[idx];
+    m_freeLists[idx] = node;
+}
+
+void* MemPool::allocDirect(std::size_t size)
+{
+    if (m_allocCb != nullptr) {
+        return m_allocCb(m_allocData, static_cast<unsigned>(size));
+    }
+
+    return ::operator new(size, std::nothrow);
+}
+
+void MemPool::freeDirect(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    if (m_freeCb != nullptr) {
+        m_freeCb(m_allocData, ptr);
+        return;
+    }
+
+    ::operator delete(ptr);
+}
+
+unsigned MemPool::classIdx(std::size_t size)
+{
+    for (auto idx = 0U; idx < ClassesCount; ++idx) {
+        if (size <= classSize(idx)) {
+            return idx;
+        }
+    }
+
+    return ClassesCount;
+}
+
+bool MemPool::allocChunk(std::size_t minSize)
+{
+    recycleChunkRemainder();
+
+    auto size = sizeof(ChunkHdr) + std::max<std::size_t>(m_chunkSize, minSize);
+    auto* mem = allocDirect(size);
+    if (mem == nullptr) {
+        return false;
+    }
+
+    auto* chunk = new (mem) ChunkHdr;
+    chunk->m_next = m_chunks;
+    m_chunks = chunk;
+    m_chunkPos = reinterpret_cast<std::uint8_t*>(chunk + 1);
+    m_chunkRem = size - sizeof(ChunkHdr);
+    m_chunksBytes += size;
+    return true;
+}
+
+void MemPool::recycleChunkRemainder()
+{
+    // The unused tail of the current chunk is split between smaller size classes
+    for (auto idx = ClassesCount; 0U < idx; --idx) {
+        auto blockSize = classSize(idx - 1U);
+        while (blockSize <= m_chunkRem) {
+            free(m_chunkPos, blockSize);
+            m_chunkPos += blockSize;
+            m_chunkRem -= blockSize;
+        }
+    }
+}
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,115 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "cc_mqtt311_client/common.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cc_mqtt311_client
+{
+
+// Client owned pool with size-class free lists, the blocks are carved
+// from the chunks of configurable size. The released blocks are recycled
+// within the same size class, the chunks are released only on destruction.
+// The chunks and the blocks not fitting any size class are allocated
+// using the user provided callbacks when such are set.
+class MemPool
+{
+public:
+    MemPool() = default;
+    MemPool(const MemPool&) = delete;
+    ~MemPool();
+
+    MemPool& operator=(const MemPool&) = delete;
+
+    void* alloc(std::size_t size);
+    void free(void* ptr, std::size_t size);
+
+    // Bypass the size classes, applicable when the pool is disabled
+    void* allocDirect(std::size_t size);
+    void freeDirect(void* ptr);
+
+    void setBackingAllocator(CC_Mqtt311AllocCb allocCb, CC_Mqtt311FreeCb freeCb, void* data)
+    {
+        m_allocCb = allocCb;
+        m_freeCb = freeCb;
+        m_allocData = data;
+    }
+
+    bool hasBackingAllocator() const
+    {
+        return m_allocCb != nullptr;
+    }
+
+    CC_Mqtt311FreeCb backingFreeCb() const
+    {
+        return m_freeCb;
+    }
+
+    void* backingData() const
+    {
+        return m_allocData;
+    }
+
+    void setChunkSize(unsigned value)
+    {
+        m_chunkSize = value;
+    }
+
+    unsigned chunkSize() const
+    {
+        return m_chunkSize;
+    }
+
+    bool isEnabled() const
+    {
+        return m_chunkSize > 0U;
+    }
+
+    std::size_t chunksBytes() const
+    {
+        return m_chunksBytes;
+    }
+
+private:
+    struct FreeNode
+    {
+        FreeNode* m_next = nullptr;
+    };
+
+    struct alignas(std::max_align_t) ChunkHdr
+    {
+        ChunkHdr* m_next = nullptr;
+    };
+
+    static constexpr std::size_t MinClassSize = 32U;
+    static constexpr unsigned ClassesCount = 8U; // Up to 4KB
+
+    static constexpr std::size_t classSize(unsigned idx)
+    {
+        return MinClassSize << idx;
+    }
+
+    static unsigned classIdx(std::size_t size);
+    bool allocChunk(std::size_t minSize);
+    void recycleChunkRemainder();
+
+    FreeNode* m_freeLists[ClassesCount] = {};
+    ChunkHdr* m_chunks = nullptr;
+    std::uint8_t* m_chunkPos = nullptr;
+    std::size_t m_chunkRem = 0U;
+    std::size_t m_chunksBytes = 0U;
+    unsigned m_chunkSize = 0U;
+    CC_Mqtt311AllocCb m_allocCb = nullptr;
+    CC_Mqtt311FreeCb m_freeCb = nullptr;
+    void* m_allocData = nullptr;
+};
+
+} // namespace cc_mqtt311_client
@@ -7,17 +7,92 @@
 
 #pragma once
 
+#include "MemPool.h"
+
 #include "comms/util/alloc.h"
 #include "comms/util/type_traits.h"
 
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
 namespace cc_mqtt311_client
 {
 
+// Dynamic memory allocation, uses the client owned pool when one is enabled
+// or the user provided allocation callbacks when such are set.
+template <typename TObj>
+class PoolMemory
+{
+    static_assert(alignof(TObj) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+
+    class Deleter
+    {
+    public:
+        Deleter() = default;
+        Deleter(MemPool* pool, bool pooled) : m_pool(pool), m_pooled(pooled) {}
+
+        void operator()(TObj* obj) const
+        {
+            if (m_pool == nullptr) {
+                delete obj;
+                return;
+            }
+
+            obj->~TObj();
+            if (m_pooled) {
+                m_pool->free(obj, sizeof(TObj));
+                return;
+            }
+
+            m_pool->freeDirect(obj);
+        }
+
+    private:
+        MemPool* m_pool = nullptr;
+        bool m_pooled = false;
+    };
+
+public:
+    using Ptr = std::unique_ptr<TObj, Deleter>;
+
+    void setPool(MemPool* pool)
+    {
+        m_pool = pool;
+    }
+
+    template <typename TType, typename... TArgs>
+    Ptr alloc(TArgs&&... args)
+    {
+        static_assert(std::is_same<TType, TObj>::value, "Only the same type is supported");
+        if ((m_pool == nullptr) || ((!m_pool->isEnabled()) && (!m_pool->hasBackingAllocator()))) {
+            return Ptr(new TObj(std::forward<TArgs>(args)...));
+        }
+
+        bool pooled = m_pool->isEnabled();
+        auto* mem = pooled ? m_pool->alloc(sizeof(TObj)) : m_pool->allocDirect(sizeof(TObj));
+        if (mem == nullptr) {
+            return Ptr();
+        }
+
+        return Ptr(new (mem) TObj(std::forward<TArgs>(args)...), Deleter(m_pool, pooled));
+    }
+
+    Ptr wrap(TObj* obj)
+    {
+        return Ptr(obj);
+    }
+
+private:
+    MemPool* m_pool = nullptr;
+};
+
 template <typename TObj, unsigned TLimit>
 class ObjAllocator
 {
     template <typename ...>
-    using DynMemoryAlloc = comms::util::alloc::DynMemory<TObj>;
+    using DynMemoryAlloc = PoolMemory<TObj>;
 
     template <typename ...>
     using InPlaceAlloc = comms::util::alloc::InPlacePool<TObj, TLimit>;
@@ -36,6 +111,18 @@ class ObjAllocator
 public:
     using Ptr = typename AllocType::Ptr;
 
+    ObjAllocator() = default;
+
+    explicit ObjAllocator(MemPool& pool)
+    {
+        if constexpr (TLimit == 0U) {
+            m_alloc.setPool(&pool);
+        }
+        else {
+            static_cast<void>(pool);
+        }
+    }
+
     template <typename... TArgs>
     Ptr alloc(TArgs&&... args)
     {
@@ -10,6 +10,8 @@
 #include "comms/util/StaticVector.h"
 #include "comms/util/type_traits.h"
 
+#include <cstddef>
+#include <type_traits>
 #include <vector>
 
 namespace cc_mqtt311_client
@@ -45,4 +47,37 @@ public:
 template <typename TObj, unsigned TLimit, bool THasFeature = true>
 using ObjListType = typename details::ObjListTypeHelper<TObj, TLimit, THasFeature>::VectorType;
 
+template <typename TList>
+constexpr bool objListIsDynamic()
+{
+    return std::is_same<TList, std::vector<typename TList::value_type> >::value;
+}
+
+// Heap memory held by the list, the storage of the static vector is part of its owner
+template <typename TList>
+std::size_t objListHeapBytes(const TList& list)
+{
+    if constexpr (objListIsDynamic<TList>()) {
+        return list.capacity() * sizeof(typename TList::value_type);
+    }
+    else {
+        static_cast<void>(list);
+        return 0U;
+    }
+}
+
+// Returns the heap memory of the empty list back to the allocator
+template <typename TList>
+void objListRelease(TList& list)
+{
+    if constexpr (objListIsDynamic<TList>()) {
+        if (list.empty() && (0U < list.capacity())) {
+            TList().swap(list);
+        }
+    }
+    else {
+        static_cast<void>(list);
+    }
+}
+
 } // namespace cc_mqtt311_client
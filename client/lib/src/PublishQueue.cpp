@@ -0,0 +1,132 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "PublishQueue.h"
+
+#include "comms/Assert.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace cc_mqtt311_client
+{
+
+CC_Mqtt311ErrorCode PublishQueue::setCapacity(unsigned value)
+{
+    if (front() != nullptr) {
+        return CC_Mqtt311ErrorCode_Busy;
+    }
+
+    COMMS_ASSERT((ExtConfig::PublishQueueLimit == 0U) || (value <= ExtConfig::PublishQueueLimit));
+    if (!m_cells.allocate(value)) {
+        m_capacity = 0U;
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
+    m_capacity = value;
+    m_head = 0U;
+    m_tail.store(0U, std::memory_order_relaxed);
+    auto* cellsPtr = cells();
+    for (auto idx = 0U; idx < m_capacity; ++idx) {
+        cellsPtr[idx].m_entry = Entry();
+        cellsPtr[idx].m_seq.store(idx, std::memory_order_relaxed);
+    }
+
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+CC_Mqtt311ErrorCode PublishQueue::push(const CC_Mqtt311PublishConfig& config, bool copy, CC_Mqtt311PublishCompleteCb cb, void* cbData)
+{
+    if (m_capacity == 0U) {
+        return CC_Mqtt311ErrorCode_QueueFull;
+    }
+
+    // The entry is populated before claiming the cell to keep the 
+    // window between the claim and the publication short.
+    Entry entry;
+    entry.m_config = config;
+    entry.m_cb = cb;
+    entry.m_cbData = cbData;
+
+    if (copy) {
+        if (!OwnedStorage::isSupported()) {
+            return CC_Mqtt311ErrorCode_NotSupported;
+        }
+
+        auto topicLen = std::strlen(config.m_topic) + 1U;
+        auto* owned = entry.m_owned.allocate(topicLen + config.m_dataLen);
+        COMMS_ASSERT(owned != nullptr);
+        std::copy_n(config.m_topic, topicLen, owned);
+        if (0U < config.m_dataLen) {
+            std::copy_n(config.m_data, config.m_dataLen, owned + topicLen);
+        }
+
+        // The storage buffer survives the move into the cell
+        entry.m_config.m_topic = owned;
+        entry.m_config.m_data = reinterpret_cast<const unsigned char*>(owned + topicLen);
+    }
+
+    auto* cellsPtr = cells();
+    auto pos = m_tail.load(std::memory_order_relaxed);
+    while (true) {
+        auto& cell = cellsPtr[pos % m_capacity];
+        auto seq = cell.m_seq.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+        if (diff < 0) {
+            // The cell hasn't been released by the consumer yet
+            return CC_Mqtt311ErrorCode_QueueFull;
+        }
+
+        if (0 < diff) {
+            // Claimed by another producer
+            pos = m_tail.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!m_tail.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed)) {
+            continue;
+        }
+
+        cell.m_entry = std::move(entry);
+        cell.m_seq.store(pos + 1U, std::memory_order_release);
+        break;
+    }
+
+    if ((m_wakeupCb != nullptr) && (!m_wakeupPending.exchange(true, std::memory_order_acq_rel))) {
+        m_wakeupCb(m_wakeupData);
+    }
+
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+PublishQueue::Entry* PublishQueue::front()
+{
+    if (m_capacity == 0U) {
+        return nullptr;
+    }
+
+    auto& cell = cells()[m_head % m_capacity];
+    if (cell.m_seq.load(std::memory_order_acquire) != (m_head + 1U)) {
+        return nullptr;
+    }
+
+    return &cell.m_entry;
+}
+
+void PublishQueue::pop()
+{
+    auto& cell = cells()[m_head % m_capacity];
+    COMMS_ASSERT(cell.m_seq.load(std::memory_order_relaxed) == (m_head + 1U));
+    cell.m_entry = Entry();
+    cell.m_seq.store(m_head + m_capacity, std::memory_order_release);
+    ++m_head;
+}
+
+} // namespace cc_mqtt311_client
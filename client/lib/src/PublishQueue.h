@@ -0,0 +1,197 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ExtConfig.h"
+
+#include "cc_mqtt311_client/common.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace cc_mqtt311_client
+{
+
+// Copy of the topic and data of the request, available only with the
+// dynamic memory allocation.
+template <bool THasDynMemAlloc>
+class PublishQueueOwnedData
+{
+public:
+    static constexpr bool isSupported()
+    {
+        return true;
+    }
+
+    char* allocate(std::size_t len)
+    {
+        m_data.resize(len);
+        return m_data.data();
+    }
+
+private:
+    std::vector<char> m_data;
+};
+
+template <>
+class PublishQueueOwnedData<false>
+{
+public:
+    static constexpr bool isSupported()
+    {
+        return false;
+    }
+
+    char* allocate([[maybe_unused]] std::size_t len)
+    {
+        return nullptr;
+    }
+};
+
+// The cells are allocated at runtime when the limit is not configured.
+template <typename TCell, unsigned TLimit>
+class PublishQueueCells
+{
+public:
+    bool allocate(unsigned count)
+    {
+        return count <= TLimit;
+    }
+
+    TCell* data()
+    {
+        return m_cells.data();
+    }
+
+    std::size_t heapBytes([[maybe_unused]] unsigned count) const
+    {
+        return 0U;
+    }
+
+private:
+    std::array<TCell, TLimit> m_cells;
+};
+
+template <typename TCell>
+class PublishQueueCells<TCell, 0U>
+{
+public:
+    bool allocate(unsigned count)
+    {
+        m_cells.reset();
+        if (count == 0U) {
+            return true;
+        }
+
+        m_cells.reset(new (std::nothrow) TCell[count]);
+        return static_cast<bool>(m_cells);
+    }
+
+    TCell* data()
+    {
+        return m_cells.get();
+    }
+
+    std::size_t heapBytes(unsigned count) const
+    {
+        return count * sizeof(TCell);
+    }
+
+private:
+    std::unique_ptr<TCell[]> m_cells;
+};
+
+// Bounded lock-free multi-producer single-consumer ring of the publish
+// requests. Every cell carries a sequence number telling the producers
+// whether it is free and the consumer whether it has been filled.
+// The producers can push from any thread, all the other member
+// functions must be invoked by the thread owning the client.
+class PublishQueue
+{
+public:
+    using OwnedStorage = PublishQueueOwnedData<ExtConfig::HasDynMemAlloc>;
+
+    struct Entry
+    {
+        CC_Mqtt311PublishConfig m_config = CC_Mqtt311PublishConfig();
+        CC_Mqtt311PublishCompleteCb m_cb = nullptr;
+        void* m_cbData = nullptr;
+        OwnedStorage m_owned;
+    };
+
+    static constexpr bool isSupported()
+    {
+        return ExtConfig::HasDynMemAlloc || (ExtConfig::PublishQueueLimit > 0U);
+    }
+
+    static constexpr unsigned maxLimit()
+    {
+        return ExtConfig::PublishQueueLimit;
+    }
+
+    PublishQueue() = default;
+    PublishQueue(const PublishQueue&) = delete;
+    PublishQueue& operator=(const PublishQueue&) = delete;
+
+    CC_Mqtt311ErrorCode setCapacity(unsigned value);
+
+    unsigned capacity() const
+    {
+        return m_capacity;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return m_cells.heapBytes(m_capacity);
+    }
+
+    void setWakeupCallback(CC_Mqtt311PublishQueueWakeupCb cb, void* data)
+    {
+        m_wakeupCb = cb;
+        m_wakeupData = data;
+    }
+
+    CC_Mqtt311ErrorCode push(const CC_Mqtt311PublishConfig& config, bool copy, CC_Mqtt311PublishCompleteCb cb, void* cbData);
+
+    // The producers pushing after this call will request new wakeup
+    void rearmWakeup()
+    {
+        m_wakeupPending.store(false, std::memory_order_release);
+    }
+
+    Entry* front();
+    void pop();
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> m_seq{0U};
+        Entry m_entry;
+    };
+
+    using CellsStorage = PublishQueueCells<Cell, ExtConfig::PublishQueueLimit>;
+
+    Cell* cells()
+    {
+        return m_cells.data();
+    }
+
+    CellsStorage m_cells;
+    unsigned m_capacity = 0U;
+    std::size_t m_head = 0U; // Accessed by the owning thread only
+    CC_Mqtt311PublishQueueWakeupCb m_wakeupCb = nullptr;
+    void* m_wakeupData = nullptr;
+    std::atomic<bool> m_wakeupPending{false};
+    alignas(64) std::atomic<std::size_t> m_tail{0U}; // Avoid sharing the cache line with the consumer data
+};
+
+} // namespace cc_mqtt311_client
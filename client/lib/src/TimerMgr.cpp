@@ -23,6 +23,7 @@ TimerMgr::Timer TimerMgr::allocTimer()
         {
             m_timers[idx].m_allocated = true;
             ++m_allocatedTimers;
+            m_allocatedTimersMax = std::max(m_allocatedTimersMax, m_allocatedTimers);
             return Timer(*this, idx);
         };
 
@@ -58,10 +59,15 @@ void TimerMgr::tick(unsigned ms)
     {
         TimeoutCb m_timeoutCb = nullptr;
         void* m_timeoutData = nullptr;
+        unsigned m_idx = 0U;
     };
 
     using CbList = ObjListType<CbInfo, ExtConfig::TimersLimit>;
     CbList cbList;
+    m_elapsedMs += ms;
+    if (m_trace != nullptr) {
+        m_trace->setTimestamp(m_elapsedMs);
+    }
 
     for (auto idx = 0U; idx < m_timers.size(); ++idx) {
         auto& info = m_timers[idx];
@@ -72,7 +78,7 @@ void TimerMgr::tick(unsigned ms)
         }
 
         if (info.m_timeoutMs <= ms) {
-            cbList.push_back({info.m_timeoutCb, info.m_timeoutData});
+            cbList.push_back({info.m_timeoutCb, info.m_timeoutData, idx});
             timerCancel(idx);
             continue;
         }
@@ -81,6 +87,10 @@ void TimerMgr::tick(unsigned ms)
     }
 
     for (auto& info : cbList) {
+        if (m_trace != nullptr) {
+            m_trace->timerFire(info.m_idx);
+        }
+
         info.m_timeoutCb(info.m_timeoutData);
     }
 }
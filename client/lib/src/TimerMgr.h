@@ -7,12 +7,15 @@
 
 #pragma once
 
+#include "ClientTrace.h"
 #include "ExtConfig.h"
 #include "ObjListType.h"
 
 #include "comms/util/StaticVector.h"
 #include "comms/util/type_traits.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 
 namespace cc_mqtt311_client
@@ -96,6 +99,32 @@ public:
     unsigned getMinWait() const;
     unsigned allocCount() const;
 
+    // Total time reported via tick() since the creation
+    std::uint64_t elapsed() const
+    {
+        return m_elapsedMs;
+    }
+
+    unsigned allocHighWaterMark() const
+    {
+        return m_allocatedTimersMax;
+    }
+
+    void resetAllocHighWaterMark()
+    {
+        m_allocatedTimersMax = m_allocatedTimers;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return objListHeapBytes(m_timers);
+    }
+
+    void setTrace(ClientTrace* trace)
+    {
+        m_trace = trace;
+    }
+
 private:
     struct TimerInfo
     {
@@ -118,7 +147,10 @@ private:
     bool timerIsSuspended(unsigned idx) const;
 
     StorageType m_timers;
+    std::uint64_t m_elapsedMs = 0U;
+    ClientTrace* m_trace = nullptr;
     unsigned m_allocatedTimers = 0U;
+    unsigned m_allocatedTimersMax = 0U;
 };
 
 } // namespace cc_mqtt311_client
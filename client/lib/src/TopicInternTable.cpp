@@ -0,0 +1,125 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "TopicInternTable.h"
+
+#include "comms/Assert.h"
+
+#include <cstring>
+
+namespace cc_mqtt311_client
+{
+
+unsigned TopicInternTable::intern(const TopicStr& topic)
+{
+    if (m_limit == 0U) {
+        return 0U;
+    }
+
+    auto hash = calcHash(topic);
+    if (!m_slots.empty()) {
+        auto mask = static_cast<unsigned>(m_slots.size()) - 1U;
+        for (auto idx = hash & mask; m_slots[idx] != 0U; idx = (idx + 1U) & mask) {
+            auto& entry = m_entries[m_slots[idx] - 1U];
+            if ((entry.m_hash == hash) && isSameTopic(entry.m_topic, topic)) {
+                return m_slots[idx];
+            }
+        }
+    }
+
+    if ((m_limit <= m_entries.size()) || (m_entries.max_size() <= m_entries.size())) {
+        // No eviction, the reported IDs must remain stable
+        return 0U;
+    }
+
+    auto requiredSlots = slotsCount(static_cast<unsigned>(m_entries.size()) + 1U);
+    if (m_slots.size() < requiredSlots) {
+        rehash(requiredSlots);
+    }
+
+    m_entries.emplace_back();
+    auto& entry = m_entries.back();
+    entry.m_hash = hash;
+    if (!assignTopic(entry.m_topic, topic)) {
+        m_entries.pop_back();
+        return 0U;
+    }
+
+    auto id = static_cast<unsigned>(m_entries.size());
+    insertSlot(hash, id);
+    return id;
+}
+
+const char* TopicInternTable::topic(unsigned id) const
+{
+    if ((id == 0U) || (m_entries.size() < id)) {
+        return nullptr;
+    }
+
+    return m_entries[id - 1U].m_topic.c_str();
+}
+
+void TopicInternTable::setLimit(unsigned limit)
+{
+    m_entries.clear();
+    m_slots.clear();
+    m_limit = limit;
+}
+
+std::uint32_t TopicInternTable::calcHash(const TopicStr& topic)
+{
+    // FNV-1a
+    std::uint32_t hash = 2166136261U;
+    auto* str = topic.c_str();
+    for (auto idx = 0U; idx < topic.size(); ++idx) {
+        hash ^= static_cast<std::uint8_t>(str[idx]);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+bool TopicInternTable::isSameTopic(const EntryTopicStr& entryTopic, const TopicStr& topic)
+{
+    return 
+        (entryTopic.size() == topic.size()) &&
+        (std::memcmp(entryTopic.c_str(), topic.c_str(), topic.size()) == 0);
+}
+
+bool TopicInternTable::assignTopic(EntryTopicStr& entryTopic, const TopicStr& topic)
+{
+    if constexpr (IsTopicInArena && (!ExtConfig::HasDynMemAlloc)) {
+        if (EntryTopicMaxLen < topic.size()) {
+            return false;
+        }
+    }
+
+    entryTopic.assign(topic.c_str(), topic.size());
+    return entryTopic.size() == topic.size();
+}
+
+void TopicInternTable::insertSlot(std::uint32_t hash, unsigned id)
+{
+    COMMS_ASSERT(!m_slots.empty());
+    auto mask = static_cast<unsigned>(m_slots.size()) - 1U;
+    auto idx = hash & mask;
+    while (m_slots[idx] != 0U) {
+        idx = (idx + 1U) & mask;
+    }
+
+    m_slots[idx] = id;
+}
+
+void TopicInternTable::rehash(unsigned count)
+{
+    COMMS_ASSERT(count <= m_slots.max_size());
+    m_slots.assign(count, 0U);
+    for (auto idx = 0U; idx < m_entries.size(); ++idx) {
+        insertSlot(m_entries[idx].m_hash, idx + 1U);
+    }
+}
+
+} // namespace cc_mqtt311_client
@@ -0,0 +1,108 @@
+//
+// Copyright 2024 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ExtConfig.h"
+#include "FieldArena.h"
+#include "ObjListType.h"
+#include "ProtocolDefs.h"
+
+#include "comms/util/StaticString.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace cc_mqtt311_client
+{
+
+class TopicInternTable
+{
+public:
+    using TopicStr = PublishMsg::Field_topic::ValueType;
+
+    static constexpr bool isSupported()
+    {
+        return ExtConfig::HasDynMemAlloc || (ExtConfig::TopicInternLimit > 0U);
+    }
+
+    static constexpr unsigned maxLimit()
+    {
+        return ExtConfig::TopicInternLimit;
+    }
+
+    unsigned intern(const TopicStr& topic);
+    const char* topic(unsigned id) const;
+    void setLimit(unsigned limit);
+
+    unsigned limit() const
+    {
+        return m_limit;
+    }
+
+    std::size_t heapBytes() const
+    {
+        return objListHeapBytes(m_entries) + objListHeapBytes(m_slots);
+    }
+
+private:
+    // The interned topics are kept until the limit is reset, they don't 
+    // occupy the field arena shared with the messages being processed.
+    static constexpr bool IsTopicInArena = std::is_same<TopicStr, FieldArenaString>::value;
+    static constexpr unsigned EntryTopicMaxLen = ExtConfig::TopicInternMaxLen;
+    using EntryTopicStr = 
+        typename std::conditional<
+            !IsTopicInArena,
+            TopicStr,
+            typename std::conditional<
+                ExtConfig::HasDynMemAlloc,
+                std::string,
+                comms::util::StaticString<std::max(EntryTopicMaxLen, 1U) + 1U>
+            >::type
+        >::type;
+
+    static_assert(
+        ExtConfig::HasDynMemAlloc || (!IsTopicInArena) || (ExtConfig::TopicInternLimit == 0U) || (EntryTopicMaxLen > 0U), 
+        "Must use CC_MQTT311_CLIENT_TOPIC_INTERN_MAX_LEN in configuration to limit length of the interned topics");
+
+    struct Entry
+    {
+        std::uint32_t m_hash = 0U;
+        EntryTopicStr m_topic;
+    };
+
+    static constexpr unsigned MinSlots = 16U;
+
+    static constexpr unsigned slotsCount(unsigned entries)
+    {
+        unsigned result = MinSlots;
+        while (result < (entries * 2U)) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    static constexpr unsigned SlotsLimit = ExtConfig::TopicInternLimit == 0U ? 0U : slotsCount(ExtConfig::TopicInternLimit);
+
+    using EntriesList = ObjListType<Entry, ExtConfig::TopicInternLimit>;
+    using SlotsList = ObjListType<unsigned, SlotsLimit>;
+
+    static std::uint32_t calcHash(const TopicStr& topic);
+    static bool isSameTopic(const EntryTopicStr& entryTopic, const TopicStr& topic);
+    static bool assignTopic(EntryTopicStr& entryTopic, const TopicStr& topic);
+    void insertSlot(std::uint32_t hash, unsigned id);
+    void rehash(unsigned count);
+
+    EntriesList m_entries;
+    SlotsList m_slots; // Open addressing index of the entries, stores entry index + 1
+    unsigned m_limit = 0U;
+};
+
+} // namespace cc_mqtt311_client
@@ -74,6 +74,12 @@ CC_Mqtt311ErrorCode ConnectOp::config(const CC_Mqtt311ConnectConfig& config)
         return CC_Mqtt311ErrorCode_BadParam;        
     }
 
+    if (isFieldStorageExhausted(clientIdStr, config.m_clientId)) {
+        errorLog("Insufficient field storage for the client ID");
+        clientIdStr.clear();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     if ((m_connectMsg.field_clientId().value().empty()) && (!config.m_cleanSession)) {
         errorLog("Clean start flag needs to be set for empty client id");
         return CC_Mqtt311ErrorCode_BadParam;
@@ -92,6 +98,12 @@ CC_Mqtt311ErrorCode ConnectOp::config(const CC_Mqtt311ConnectConfig& config)
         return CC_Mqtt311ErrorCode_BadParam;        
     }
 
+    if (hasUsername && isFieldStorageExhausted(usernameStr, config.m_username)) {
+        errorLog("Insufficient field storage for the username");
+        usernameStr.clear();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     bool hasPassword = (config.m_passwordLen > 0U);
     m_connectMsg.field_flags().field_high().setBitValue_passwordFlag(hasPassword);
 
@@ -106,6 +118,12 @@ CC_Mqtt311ErrorCode ConnectOp::config(const CC_Mqtt311ConnectConfig& config)
         return CC_Mqtt311ErrorCode_BadParam;        
     }    
 
+    if (hasPassword && isFieldStorageExhausted(passwordStr, config.m_passwordLen)) {
+        errorLog("Insufficient field storage for the password");
+        passwordStr.clear();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     m_connectMsg.field_flags().field_low().setBitValue_cleanSession(config.m_cleanSession);    
 
     static constexpr auto MaxKeepAlive = 
@@ -146,6 +164,12 @@ CC_Mqtt311ErrorCode ConnectOp::configWill(const CC_Mqtt311ConnectWillConfig& con
         return CC_Mqtt311ErrorCode_BadParam;        
     }
 
+    if (isFieldStorageExhausted(willTopicStr, config.m_topic)) {
+        errorLog("Insufficient field storage for the will topic.");
+        willTopicStr.clear();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     auto& willData = m_connectMsg.field_willMessage().field().value();
     if (config.m_dataLen > 0U) {
         comms::util::assign(willData, config.m_data, config.m_data + config.m_dataLen);
@@ -157,6 +181,12 @@ CC_Mqtt311ErrorCode ConnectOp::configWill(const CC_Mqtt311ConnectWillConfig& con
         return CC_Mqtt311ErrorCode_BadParam;                
     }
 
+    if (isFieldStorageExhausted(willData, config.m_dataLen)) {
+        errorLog("Insufficient field storage for the will data.");
+        willData.clear();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     m_connectMsg.field_flags().field_willQos().setValue(config.m_qos);
     m_connectMsg.field_flags().field_high().setBitValue_willRetain(config.m_retain);
     m_connectMsg.field_flags().field_low().setBitValue_willFlag(true);
@@ -298,6 +328,7 @@ void ConnectOp::completeOpInternal(CC_Mqtt311AsyncOpStatus status, const CC_Mqtt
 
 void ConnectOp::opTimeoutInternal()
 {
+    client().stats().timeout();
     completeOpInternal(CC_Mqtt311AsyncOpStatus_Timeout);
 }
 
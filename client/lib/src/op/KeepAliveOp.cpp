@@ -93,6 +93,7 @@ void KeepAliveOp::sendPing()
 
 void KeepAliveOp::pingTimeoutInternal()
 {
+    client().stats().timeout();
     errorLog("The broker did not respond to PING");
     COMMS_ASSERT(!m_respTimer.isActive());
     client().brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_NoBrokerResponse);
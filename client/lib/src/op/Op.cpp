@@ -95,6 +95,22 @@ std::uint16_t Op::allocPacketId()
     return lastPacketId;
 }
 
+bool Op::reservePacketId(std::uint16_t id)
+{
+    auto& allocatedPacketIds = m_client.clientState().m_allocatedPacketIds;
+    if ((id == 0U) || (allocatedPacketIds.max_size() <= allocatedPacketIds.size())) {
+        return false;
+    }
+
+    auto iter = std::lower_bound(allocatedPacketIds.begin(), allocatedPacketIds.end(), id);
+    if ((iter != allocatedPacketIds.end()) && (*iter == id)) {
+        return false;
+    }
+
+    allocatedPacketIds.insert(iter, id);
+    return true;
+}
+
 void Op::releasePacketId(std::uint16_t id)
 {
     if (id == 0U) {
@@ -196,14 +212,14 @@ bool Op::verifySubFilterInternal(const char* filter)
     }
 }
 
-bool Op::verifyPubTopicInternal(const char* topic, bool outgoing)
+bool Op::verifyPubTopicInternal(ClientImpl& client, const char* topic, bool outgoing)
 {
     if (Config::HasTopicFormatVerification) {
-        if (outgoing && (!m_client.configState().m_verifyOutgoingTopic)) {
+        if (outgoing && (!client.configState().m_verifyOutgoingTopic)) {
             return true;
         }
 
-        if ((!outgoing) && (!m_client.configState().m_verifyIncomingTopic)) {
+        if ((!outgoing) && (!client.configState().m_verifyIncomingTopic)) {
             return true;
         }
 
@@ -213,7 +229,7 @@ bool Op::verifyPubTopicInternal(const char* topic, bool outgoing)
         }
 
         if (outgoing && (topic[0] == '$')) {
-            errorLog("Cannot start topic with \'$\'.");
+            client.errorLog("Cannot start topic with \'$\'.");
             return false;
         }
 
@@ -230,7 +246,7 @@ bool Op::verifyPubTopicInternal(const char* topic, bool outgoing)
 
             if ((ch == MultLevelWildcard) || 
                 (ch == SingleLevelWildcard)) {
-                errorLog("Wildcards cannot be used in publish topic");
+                client.errorLog("Wildcards cannot be used in publish topic");
                 return false;
             }
         }
@@ -13,6 +13,7 @@
 
 #include "cc_mqtt311_client/common.h"
 
+#include <cstring>
 #include <limits>
 
 namespace cc_mqtt311_client
@@ -83,6 +84,7 @@ protected:
     void sendMessage(const ProtMessage& msg);
     void opComplete();
     std::uint16_t allocPacketId();
+    bool reservePacketId(std::uint16_t id);
     void releasePacketId(std::uint16_t id);
 
     ClientImpl& client()
@@ -113,24 +115,58 @@ protected:
     }    
 
     inline bool verifyPubTopic(const char* topic, bool outgoing)
+    {
+        return verifyPubTopic(m_client, topic, outgoing);
+    }     
+
+    inline 
+    static bool verifyPubTopic(ClientImpl& client, const char* topic, bool outgoing)
     {
         if (Config::HasTopicFormatVerification) {
-            return verifyPubTopicInternal(topic, outgoing);
+            return verifyPubTopicInternal(client, topic, outgoing);
         }
         else {
             return true;
         }
-    }     
+    }
 
     static constexpr std::size_t maxStringLen()
     {
         return std::numeric_limits<std::uint16_t>::max();
     }
 
+    // Detects failed allocation of the variable length field storage
+    // from the arena (CC_MQTT311_CLIENT_FIELD_ARENA_SIZE).
+    template <typename TStorage>
+    static bool isFieldStorageExhausted(const TStorage& storage, std::size_t expLen)
+    {
+        if constexpr (Config::FieldArenaSize == 0U) {
+            static_cast<void>(storage);
+            static_cast<void>(expLen);
+            return false;
+        }
+        else {
+            return storage.size() < expLen;
+        }
+    }
+
+    template <typename TStorage>
+    static bool isFieldStorageExhausted(const TStorage& storage, const char* str)
+    {
+        if constexpr (Config::FieldArenaSize == 0U) {
+            static_cast<void>(storage);
+            static_cast<void>(str);
+            return false;
+        }
+        else {
+            return (str != nullptr) && (storage.size() < std::strlen(str));
+        }
+    }
+
 private:
     void errorLogInternal(const char* msg);
     bool verifySubFilterInternal(const char* filter);
-    bool verifyPubTopicInternal(const char* topic, bool outgoing);
+    static bool verifyPubTopicInternal(ClientImpl& client, const char* topic, bool outgoing);
 
     ClientImpl& m_client;    
     unsigned m_responseTimeoutMs = 0U;
@@ -130,40 +130,11 @@ void RecvOp::handle(PublishMsg& msg)
         }
     }
 
-    auto& sessionState = client().sessionState();
-
-    if (!sessionState.m_connected) {
-        errorLog("Received PUBLISH when not CONNECTED");
-        client().brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
+    if (!verifyPublish(client(), msg)) {
         return;
     }
 
     auto& topic = msg.field_topic().value();
-    if ((topic.empty()) || (!verifyPubTopic(topic.c_str(), false))) {
-        errorLog("Received PUBLISH with invalid topic format.");
-        client().brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
-        return;
-    }
-
-    if constexpr (Config::HasSubTopicVerification) {
-        if (client().configState().m_verifySubFilter) {
-            auto& subFilters = client().reuseState().m_subFilters;
-            auto iter = 
-                std::find_if(
-                    subFilters.begin(), subFilters.end(),
-                    [&topic](auto& filter)
-                    {
-                        return isTopicMatch(filter, topic);
-                    });
-
-            if (iter == subFilters.end()) {
-                errorLog("Received PUBLISH on non-subscribed topic");
-                client().brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
-                return;                
-            }
-        }
-    }  
-
     auto info = CC_Mqtt311MessageInfo();
     info.m_topic = topic.c_str();
     auto& data = msg.field_payload().value();
@@ -174,9 +145,15 @@ void RecvOp::handle(PublishMsg& msg)
 
     comms::cast_assign(info.m_qos) = qos;
     info.m_retained = msg.transportField_flags().field_retain().getBitValue_bit();
+    if (!m_topicFiltered) {
+        info.m_topicId = client().topicIntern().intern(topic);
+    }
 
     if (qos == Qos::AtMostOnceDelivery) {
-        client().reportMsgInfo(info);
+        if (!m_topicFiltered) {
+            client().reportMsgInfo(info);
+        }
+
         opComplete();
         return;
     }
@@ -189,8 +166,9 @@ void RecvOp::handle(PublishMsg& msg)
             return;
         }    
 
-        client().reportMsgInfo(info);
-
+        if (!m_topicFiltered) {
+            client().reportMsgInfo(info);
+        }
     
         if (qos == Qos::AtLeastOnceDelivery) {
             PubackMsg pubackMsg;
@@ -210,6 +188,43 @@ void RecvOp::handle(PublishMsg& msg)
     }
 }
 
+bool RecvOp::verifyPublish(ClientImpl& client, const PublishMsg& msg)
+{
+    if (!client.sessionState().m_connected) {
+        client.errorLog("Received PUBLISH when not CONNECTED");
+        client.brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
+        return false;
+    }
+
+    auto& topic = msg.field_topic().value();
+    if ((topic.empty()) || (!verifyPubTopic(client, topic.c_str(), false))) {
+        client.errorLog("Received PUBLISH with invalid topic format.");
+        client.brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
+        return false;
+    }
+
+    if constexpr (Config::HasSubTopicVerification) {
+        if (client.configState().m_verifySubFilter) {
+            auto& subFilters = client.reuseState().m_subFilters;
+            auto iter = 
+                std::find_if(
+                    subFilters.begin(), subFilters.end(),
+                    [&topic](auto& filter)
+                    {
+                        return isTopicMatch(filter, topic);
+                    });
+
+            if (iter == subFilters.end()) {
+                client.errorLog("Received PUBLISH on non-subscribed topic");
+                client.brokerDisconnected(CC_Mqtt311BrokerDisconnectReason_ProtocolError);
+                return false;                
+            }
+        }
+    }  
+
+    return true;
+}
+
 #if CC_MQTT311_CLIENT_MAX_QOS >= 2
 void RecvOp::handle(PubrelMsg& msg)
 {
@@ -271,6 +286,7 @@ void RecvOp::restartResponseTimer()
 
 void RecvOp::responseTimeoutInternal()
 {
+    client().stats().timeout();
     if constexpr (Config::MaxQos >= 2) {
         // When there is no response from broker, just terminate the reception.
         // The retry will be initiated by the broker.
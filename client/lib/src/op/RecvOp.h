@@ -40,6 +40,14 @@ public:
     void resetTimer();
     void postReconnectionResume();
 
+    void setTopicFiltered(bool value)
+    {
+        m_topicFiltered = value;
+    }
+
+    // Reports the protocol error to the client on failure
+    static bool verifyPublish(ClientImpl& client, const PublishMsg& msg);
+
 protected:
     virtual Type typeImpl() const override;    
     virtual void connectivityChangedImpl() override;
@@ -52,6 +60,7 @@ private:
 
     TimerMgr::Timer m_responseTimer;  
     unsigned m_packetId = 0U;
+    bool m_topicFiltered = false;
 
     static_assert(ExtConfig::RecvOpTimers == 1U);
 };
@@ -8,8 +8,11 @@
 #include "op/SendOp.h"
 #include "ClientImpl.h"
 
+#include "comms/cast.h"
 #include "comms/units.h"
 
+#include <limits>
+
 namespace cc_mqtt311_client
 {
 
@@ -35,6 +38,7 @@ SendOp::SendOp(ClientImpl& client) :
 
 SendOp::~SendOp()
 {
+    leaveOfflineQueue();
     releasePacketId(m_pubMsg.field_packetId().field().value());
 }
 
@@ -70,6 +74,7 @@ void SendOp::handle([[maybe_unused]] PubackMsg& msg)
     }
 
     terminateOnExit.release();
+    recordLatency(CC_Mqtt311LatencyType_PublishQos1, m_sendTimestamp);
     status = CC_Mqtt311AsyncOpStatus_Complete;
 }
 #endif // #if CC_MQTT311_CLIENT_MAX_QOS >= 1 
@@ -117,6 +122,10 @@ void SendOp::handle(PubrecMsg& msg)
     terminateOnExit.release();
 
     m_acked = true;
+    m_reconnectionResendPending = false;
+    m_pubrecTimestamp = client().timerMgr().elapsed();
+    recordLatency(CC_Mqtt311LatencyType_PublishToPubrec, m_sendTimestamp);
+    reportStoreRecord(CC_Mqtt311SessionStoreRecordType_Pubrec);
     m_sendAttempts = 0U;
     PubrelMsg pubrelMsg;
     pubrelMsg.field_packetId().setValue(m_pubMsg.field_packetId().field().value());
@@ -169,6 +178,8 @@ void SendOp::handle(PubcompMsg& msg)
     }    
 
     terminateOnExit.release();
+    recordLatency(CC_Mqtt311LatencyType_PubrecToPubcomp, m_pubrecTimestamp);
+    recordLatency(CC_Mqtt311LatencyType_PublishQos2, m_sendTimestamp);
     status = CC_Mqtt311AsyncOpStatus_Complete;
 }
 #endif // #if CC_MQTT311_CLIENT_MAX_QOS >= 2
@@ -190,9 +201,25 @@ CC_Mqtt311ErrorCode SendOp::config(const CC_Mqtt311PublishConfig& config)
         return CC_Mqtt311ErrorCode_BadParam;
     }
 
+    if (CC_Mqtt311PublishPriority_ValuesLimit <= config.m_priority) {
+        errorLog("Bad priority value in publish.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    if (isPayloadStreamed() && (config.m_dataLen > 0U)) {
+        errorLog("Publish payload source has already been configured.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_priority = config.m_priority;
     m_pubMsg.transportField_flags().field_retain().setBitValue_bit(config.m_retain);
     m_pubMsg.transportField_flags().field_qos().setValue(config.m_qos);
-    m_pubMsg.field_topic().value() = config.m_topic;
+    auto& topicStr = m_pubMsg.field_topic().value();
+    topicStr = config.m_topic;
+    if (isFieldStorageExhausted(topicStr, config.m_topic)) {
+        errorLog("Insufficient field storage for the publish topic");
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
 
     auto& dataVec = m_pubMsg.field_payload().value();
     if (config.m_dataLen > 0U) {
@@ -205,6 +232,80 @@ CC_Mqtt311ErrorCode SendOp::config(const CC_Mqtt311PublishConfig& config)
         return CC_Mqtt311ErrorCode_BadParam;
     }      
 
+    if (isFieldStorageExhausted(dataVec, config.m_dataLen)) {
+        errorLog("Insufficient field storage for the publish data");
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+CC_Mqtt311ErrorCode SendOp::configPayloadSource(unsigned dataLen, CC_Mqtt311PublishPayloadReadCb cb, void* cbData)
+{
+    if ((dataLen == 0U) || (cb == nullptr)) {
+        errorLog("Invalid publish payload source.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    if (!m_pubMsg.field_payload().value().empty()) {
+        errorLog("Publish data has already been configured.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_payloadReadCb = cb;
+    m_payloadReadData = cbData;
+    m_payloadLen = dataLen;
+    return CC_Mqtt311ErrorCode_Success;
+}
+
+CC_Mqtt311ErrorCode SendOp::restore(
+    const CC_Mqtt311PublishRestoreConfig& restoreConfig, 
+    CC_Mqtt311PublishCompleteCb cb, 
+    void* cbData)
+{
+    if (!m_responseTimer.isValid()) {
+        errorLog("The library cannot allocate required number of timers.");
+        return CC_Mqtt311ErrorCode_InternalError;
+    }  
+
+    if (restoreConfig.m_config.m_qos == CC_Mqtt311QoS_AtMostOnceDelivery) {
+        errorLog("Only QoS1 and QoS2 publishes can be restored.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    if (restoreConfig.m_pubrecReceived && (restoreConfig.m_config.m_qos != CC_Mqtt311QoS_ExactlyOnceDelivery)) {
+        errorLog("PUBREC can be received only for the QoS2 publish.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    if (std::numeric_limits<std::uint16_t>::max() < restoreConfig.m_packetId) {
+        errorLog("Packet ID of the restored publish is too high.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    auto ec = config(restoreConfig.m_config);
+    if (ec != CC_Mqtt311ErrorCode_Success) {
+        return ec;
+    }
+
+    auto packetId = static_cast<std::uint16_t>(restoreConfig.m_packetId);
+    if (!reservePacketId(packetId)) {
+        errorLog("Packet ID of the restored publish is invalid or already in use.");
+        return CC_Mqtt311ErrorCode_BadParam;
+    }
+
+    m_pubMsg.field_packetId().field().setValue(packetId);
+    m_pubMsg.doRefresh(); // Update packetId presence
+
+    m_cb = cb;
+    m_cbData = cbData;
+    m_published = true;
+    m_acked = restoreConfig.m_pubrecReceived;
+
+    // The time before the restoration is unknown, measure since now
+    m_sendTimestamp = client().timerMgr().elapsed();
+    m_pubrecTimestamp = m_sendTimestamp;
+    m_sendAttempts = 1U; // The message is resent on session resumption
     return CC_Mqtt311ErrorCode_Success;
 }
 
@@ -247,6 +348,7 @@ CC_Mqtt311ErrorCode SendOp::send(CC_Mqtt311PublishCompleteCb cb, void* cbData)
 
     m_cb = cb;
     m_cbData = cbData;
+    m_sendTimestamp = client().timerMgr().elapsed();
 
     if (m_pubMsg.transportField_flags().field_qos().value() > Qos::AtMostOnceDelivery) {
         m_pubMsg.field_packetId().field().setValue(allocPacketId());
@@ -258,6 +360,13 @@ CC_Mqtt311ErrorCode SendOp::send(CC_Mqtt311PublishCompleteCb cb, void* cbData)
         COMMS_ASSERT(!m_paused);
         m_paused = true;
 
+        if ((!client().sessionState().m_connected) && client().configState().m_offlineQueueEnabled) {
+            enterOfflineQueue();
+            if (!client().offlineQueueAccept(this)) {
+                return CC_Mqtt311ErrorCode_QueueFull;
+            }
+        }
+
         completeOnExit.release(); // don't complete op yet
         return CC_Mqtt311ErrorCode_Success;
     }
@@ -279,19 +388,30 @@ CC_Mqtt311ErrorCode SendOp::cancel()
         client().allowNextPrepare();
     }
 
+    reportStoreRemoved(CC_Mqtt311AsyncOpStatus_Aborted);
+
     opCompleteInternal();
     return CC_Mqtt311ErrorCode_Success;
 }
 
+void SendOp::prepareReconnectionResend()
+{
+    m_reconnectionResendPending = !m_paused;
+    if (m_reconnectionResendPending) {
+        m_responseTimer.cancel();
+    }
+}
+
 void SendOp::postReconnectionResend()
 {
-    if (m_paused) {
+    if (!m_reconnectionResendPending) {
         return;
     }
 
+    m_reconnectionResendPending = false;
     COMMS_ASSERT(m_sendAttempts > 0U);
     --m_sendAttempts;
-    m_responseTimer.cancel();
+    client().trace().reconnectResend(m_pubMsg.field_packetId().field().value());
     resendDupMsg(); 
 }
 
@@ -301,9 +421,27 @@ void SendOp::forceDupResend()
         return;
     }
 
+    m_reconnectionResendPending = false;
     resendDupMsg(); 
 }
 
+std::size_t SendOp::resendLength() const
+{
+    if (!m_acked) {
+        return client().frameLength(m_pubMsg) + m_payloadLen;
+    }
+
+    PubrelMsg pubrelMsg;
+    pubrelMsg.field_packetId().setValue(m_pubMsg.field_packetId().field().value());
+    return client().frameLength(pubrelMsg);
+}
+
+void SendOp::dropOffline()
+{
+    COMMS_ASSERT(isOfflineQueued());
+    completeWithCb(CC_Mqtt311AsyncOpStatus_Aborted);
+}
+
 bool SendOp::resume()
 {
     if (!m_paused) {
@@ -315,6 +453,7 @@ bool SendOp::resume()
     }
 
     m_paused = false;
+    leaveOfflineQueue();
     auto ec = doSendInternal();
     if (ec == CC_Mqtt311ErrorCode_Success) {
         return true;
@@ -356,6 +495,7 @@ void SendOp::restartResponseTimer()
 
 void SendOp::responseTimeoutInternal()
 {
+    client().stats().timeout();
     COMMS_ASSERT(!m_responseTimer.isActive());
     errorLog("Timeout on publish acknowledgement from broker.");
     resendDupMsg();
@@ -372,7 +512,7 @@ void SendOp::resendDupMsg()
     COMMS_ASSERT(m_published);
     if (!m_acked) {
         m_pubMsg.transportField_flags().field_dup().setBitValue_bit(true);
-        auto result = client().sendMessage(m_pubMsg); 
+        auto result = sendPublishInternal(); 
         if (result != CC_Mqtt311ErrorCode_Success) {
             errorLog("Failed to resend PUBLISH message.");
             completeWithCb(CC_Mqtt311AsyncOpStatus_InternalError);
@@ -380,6 +520,7 @@ void SendOp::resendDupMsg()
         }
 
         ++m_sendAttempts;
+        client().stats().dupResend();
         restartResponseTimer();
         return;
     }
@@ -395,11 +536,17 @@ void SendOp::resendDupMsg()
     }
 
     ++m_sendAttempts;
+    client().stats().dupResend();
     restartResponseTimer();
 }
 
 void SendOp::completeWithCb(CC_Mqtt311AsyncOpStatus status)
 {
+    reportStoreRemoved(status);
+    if (status == CC_Mqtt311AsyncOpStatus_Complete) {
+        ++client().clientState().m_priorityStats[m_priority].m_completeCount;
+    }
+
     auto cb = m_cb;
     auto cbData = m_cbData;
     auto handle = toHandle();
@@ -416,28 +563,59 @@ void SendOp::completeWithCb(CC_Mqtt311AsyncOpStatus status)
 CC_Mqtt311ErrorCode SendOp::doSendInternal()
 {
     m_sendAttempts = 0U;
-    auto result = client().sendMessage(m_pubMsg); 
+    auto result = sendPublishInternal(); 
     if (result != CC_Mqtt311ErrorCode_Success) {
         return result;
     }
 
     if (!m_published) {
         m_published = true;
+        ++client().clientState().m_priorityStats[m_priority].m_sentCount;
     }
 
     ++m_sendAttempts;
 
     if (m_pubMsg.transportField_flags().field_qos().value() == Qos::AtMostOnceDelivery) {
+        recordLatency(CC_Mqtt311LatencyType_PublishQos0, m_sendTimestamp);
         completeWithCb(CC_Mqtt311AsyncOpStatus_Complete);
         return CC_Mqtt311ErrorCode_Success;
     }
 
+    reportStoreRecord(CC_Mqtt311SessionStoreRecordType_Publish);
     restartResponseTimer();
     return CC_Mqtt311ErrorCode_Success;
 }
 
+void SendOp::recordLatency(CC_Mqtt311LatencyType type, std::uint64_t since)
+{
+    auto& cl = client();
+    cl.latency().record(type, cl.timerMgr().elapsed() - since);
+}
+
+CC_Mqtt311ErrorCode SendOp::sendPublishInternal()
+{
+    if (!isPayloadStreamed()) {
+        return client().sendMessage(m_pubMsg);
+    }
+
+    return client().sendStreamedPublish(m_pubMsg, m_payloadLen, m_payloadReadCb, m_payloadReadData);
+}
+
 bool SendOp::canSend() const
 {
+    if (!client().sessionState().m_connected) {
+        return false;
+    }
+
+    if (client().sessionState().m_reconnectResendInProgress) {
+        // Don't mix new messages with the ones being resent
+        return false;
+    }
+
+    if (client().clientState().m_outputBlocked) {
+        return false;
+    }
+
     auto qos = m_pubMsg.transportField_flags().field_qos().value();
 
     if (client().configState().m_publishOrdering == CC_Mqtt311PublishOrdering_SameQos) {
@@ -454,6 +632,68 @@ bool SendOp::canSend() const
     return true;
 }
 
+void SendOp::reportStoreRecord(CC_Mqtt311SessionStoreRecordType type)
+{
+    if ((!client().hasSessionStore()) || isPayloadStreamed()) {
+        // The streamed payload is owned by the application
+        return;
+    }
+
+    auto record = CC_Mqtt311SessionStoreRecord();
+    record.m_type = type;
+    record.m_packetId = packetId();
+    record.m_qos = static_cast<decltype(record.m_qos)>(qos());
+    record.m_retain = m_pubMsg.transportField_flags().field_retain().getBitValue_bit();
+
+    if (type == CC_Mqtt311SessionStoreRecordType_Publish) {
+        auto& data = m_pubMsg.field_payload().value();
+        record.m_topic = m_pubMsg.field_topic().value().c_str();
+        comms::cast_assign(record.m_dataLen) = data.size();
+        if (!data.empty()) {
+            record.m_data = &data[0];
+        }
+    }
+
+    client().reportSessionStoreRecord(record);
+}
+
+void SendOp::reportStoreRemoved(CC_Mqtt311AsyncOpStatus status)
+{
+    if ((!m_published) || (qos() == Qos::AtMostOnceDelivery)) {
+        return;
+    }
+
+    auto type = CC_Mqtt311SessionStoreRecordType_Discard;
+    if (status == CC_Mqtt311AsyncOpStatus_Complete) {
+        type = CC_Mqtt311SessionStoreRecordType_Ack;
+    }
+
+    reportStoreRecord(type);
+}
+
+void SendOp::enterOfflineQueue()
+{
+    COMMS_ASSERT(!isOfflineQueued());
+    m_offlineQueuedLen = client().frameLength(m_pubMsg) + m_payloadLen;
+    auto& state = client().clientState();
+    ++state.m_offlineQueueMsgs;
+    state.m_offlineQueueBytes += m_offlineQueuedLen;
+}
+
+void SendOp::leaveOfflineQueue()
+{
+    if (!isOfflineQueued()) {
+        return;
+    }
+
+    auto& state = client().clientState();
+    COMMS_ASSERT(state.m_offlineQueueMsgs > 0U);
+    COMMS_ASSERT(m_offlineQueuedLen <= state.m_offlineQueueBytes);
+    --state.m_offlineQueueMsgs;
+    state.m_offlineQueueBytes -= m_offlineQueuedLen;
+    m_offlineQueuedLen = 0U;
+}
+
 void SendOp::opCompleteInternal()
 {
     opComplete();
@@ -62,11 +62,19 @@ public:
         return m_pubMsg.transportField_flags().field_qos().value();
     }
 
+    CC_Mqtt311PublishPriority priority() const
+    {
+        return m_priority;
+    }
+
     CC_Mqtt311ErrorCode config(const CC_Mqtt311PublishConfig& config);
+    CC_Mqtt311ErrorCode configPayloadSource(unsigned dataLen, CC_Mqtt311PublishPayloadReadCb cb, void* cbData);
+    CC_Mqtt311ErrorCode restore(const CC_Mqtt311PublishRestoreConfig& restoreConfig, CC_Mqtt311PublishCompleteCb cb, void* cbData);
     CC_Mqtt311ErrorCode setResendAttempts(unsigned attempts);
     unsigned getResendAttempts() const;
     CC_Mqtt311ErrorCode send(CC_Mqtt311PublishCompleteCb cb, void* cbData);
     CC_Mqtt311ErrorCode cancel();
+    void prepareReconnectionResend();
     void postReconnectionResend();
     void forceDupResend();
     bool resume();
@@ -85,6 +93,25 @@ public:
         return m_acked;
     }
 
+    bool isReconnectionResendPending() const
+    {
+        return m_reconnectionResendPending;
+    }
+
+    bool isOfflineQueued() const
+    {
+        return m_offlineQueuedLen > 0U;
+    }
+
+    bool isPayloadStreamed() const
+    {
+        return m_payloadReadCb != nullptr;
+    }
+
+    void dropOffline();
+
+    std::size_t resendLength() const;
+
 protected:
     virtual Type typeImpl() const override;    
     virtual void terminateOpImpl(CC_Mqtt311AsyncOpStatus status) override;
@@ -96,21 +123,36 @@ private:
     void resendDupMsg();
     void completeWithCb(CC_Mqtt311AsyncOpStatus status);
     void confirmRegisteredAlias();
+    void reportStoreRecord(CC_Mqtt311SessionStoreRecordType type);
+    void reportStoreRemoved(CC_Mqtt311AsyncOpStatus status);
     CC_Mqtt311ErrorCode doSendInternal();
+    CC_Mqtt311ErrorCode sendPublishInternal();
+    void enterOfflineQueue();
+    void leaveOfflineQueue();
     bool canSend() const;
     void opCompleteInternal();
 
+    void recordLatency(CC_Mqtt311LatencyType type, std::uint64_t since);
+
     static void recvTimeoutCb(void* data);
 
     TimerMgr::Timer m_responseTimer;  
     PublishMsg m_pubMsg;
     CC_Mqtt311PublishCompleteCb m_cb = nullptr;
     void* m_cbData = nullptr;    
+    CC_Mqtt311PublishPayloadReadCb m_payloadReadCb = nullptr;
+    void* m_payloadReadData = nullptr;
+    unsigned m_payloadLen = 0U;
     unsigned m_totalSendAttempts = DefaultSendAttempts;
     unsigned m_sendAttempts = 0U;
+    std::size_t m_offlineQueuedLen = 0U;
+    std::uint64_t m_sendTimestamp = 0U;
+    std::uint64_t m_pubrecTimestamp = 0U;
+    CC_Mqtt311PublishPriority m_priority = CC_Mqtt311PublishPriority_Normal;
     bool m_published = false;
     bool m_acked = false;
     bool m_paused = false;
+    bool m_reconnectionResendPending = false;
 
     static constexpr unsigned DefaultSendAttempts = 2U;
     static_assert(ExtConfig::SendOpTimers == 1U);
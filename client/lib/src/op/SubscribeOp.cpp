@@ -89,6 +89,12 @@ CC_Mqtt311ErrorCode SubscribeOp::configTopic(const CC_Mqtt311SubscribeTopicConfi
         return CC_Mqtt311ErrorCode_BadParam;
     }   
 
+    if (isFieldStorageExhausted(element.field_topic().value(), config.m_topic)) {
+        errorLog("Insufficient field storage for the subscription topic");
+        topicVec.pop_back();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     return CC_Mqtt311ErrorCode_Success;
 }
 
@@ -256,7 +262,13 @@ void SubscribeOp::handle(SubackMsg& msg)
                 return;
             }
 
-            filtersMap.insert(iter, topicStr);
+            iter = filtersMap.insert(iter, topicStr);
+            if (isFieldStorageExhausted(*iter, topicStr.size())) {
+                filtersMap.erase(iter);
+                errorLog("Failed to store subscribe filter, the field arena is exhausted");
+                status = CC_Mqtt311AsyncOpStatus_OutOfMemory;
+                return;
+            }
         }
     }
 
@@ -292,6 +304,7 @@ void SubscribeOp::completeOpInternal(CC_Mqtt311AsyncOpStatus status, const CC_Mq
 
 void SubscribeOp::opTimeoutInternal()
 {
+    client().stats().timeout();
     completeOpInternal(CC_Mqtt311AsyncOpStatus_Timeout);
 }
 
@@ -84,6 +84,12 @@ CC_Mqtt311ErrorCode UnsubscribeOp::configTopic(const CC_Mqtt311UnsubscribeTopicC
         return CC_Mqtt311ErrorCode_BadParam;
     }  
 
+    if (isFieldStorageExhausted(element.value(), config.m_topic)) {
+        errorLog("Insufficient field storage for the unsubscription topic");
+        topicVec.pop_back();
+        return CC_Mqtt311ErrorCode_OutOfMemory;
+    }
+
     return CC_Mqtt311ErrorCode_Success;
 }
 
@@ -195,6 +201,7 @@ void UnsubscribeOp::completeOpInternal(CC_Mqtt311AsyncOpStatus status)
 
 void UnsubscribeOp::opTimeoutInternal()
 {
+    client().stats().timeout();
     completeOpInternal(CC_Mqtt311AsyncOpStatus_Timeout);
 }
 
@@ -1,5 +1,6 @@
 #include "UnitTestCommonBase.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 
@@ -38,11 +39,18 @@ UnitTestCommonBase::UnitTestCommonBase(const LibFuncs& funcs) :
     m_funcs(funcs)
 {
     test_assert(m_funcs.m_alloc != nullptr);
+    test_assert(m_funcs.m_alloc_with_allocator != nullptr);
     test_assert(m_funcs.m_free != nullptr);
     test_assert(m_funcs.m_tick != nullptr);
     test_assert(m_funcs.m_process_data != nullptr);
+    test_assert(m_funcs.m_required_bytes != nullptr);
+    test_assert(m_funcs.m_input_buffer_acquire != nullptr);
+    test_assert(m_funcs.m_input_buffer_commit != nullptr);
     test_assert(m_funcs.m_notify_network_disconnected != nullptr);
     test_assert(m_funcs.m_is_network_disconnected != nullptr);
+    test_assert(m_funcs.m_notify_output_blocked != nullptr);
+    test_assert(m_funcs.m_notify_output_writable != nullptr);
+    test_assert(m_funcs.m_is_output_blocked != nullptr);
     test_assert(m_funcs.m_set_default_response_timeout != nullptr);
     test_assert(m_funcs.m_get_default_response_timeout != nullptr);
     test_assert(m_funcs.m_set_verify_outgoing_topic_enabled != nullptr);
@@ -51,6 +59,37 @@ UnitTestCommonBase::UnitTestCommonBase(const LibFuncs& funcs) :
     test_assert(m_funcs.m_get_verify_incoming_topic_enabled != nullptr);
     test_assert(m_funcs.m_set_verify_incoming_msg_subscribed != nullptr);
     test_assert(m_funcs.m_get_verify_incoming_msg_subscribed != nullptr);
+    test_assert(m_funcs.m_set_message_streaming_threshold != nullptr);
+    test_assert(m_funcs.m_get_message_streaming_threshold != nullptr);
+    test_assert(m_funcs.m_set_lazy_publish_decode != nullptr);
+    test_assert(m_funcs.m_get_lazy_publish_decode != nullptr);
+    test_assert(m_funcs.m_set_topic_intern_limit != nullptr);
+    test_assert(m_funcs.m_get_topic_intern_limit != nullptr);
+    test_assert(m_funcs.m_get_interned_topic != nullptr);
+    test_assert(m_funcs.m_set_mem_pool_chunk_size != nullptr);
+    test_assert(m_funcs.m_get_mem_pool_chunk_size != nullptr);
+    test_assert(m_funcs.m_set_lean_mode != nullptr);
+    test_assert(m_funcs.m_get_lean_mode != nullptr);
+    test_assert(m_funcs.m_get_memory_footprint != nullptr);
+    test_assert(m_funcs.m_init_output_buf_shrink_config != nullptr);
+    test_assert(m_funcs.m_set_output_buf_shrink != nullptr);
+    test_assert(m_funcs.m_get_output_buf_shrink != nullptr);
+    test_assert(m_funcs.m_get_high_water_marks != nullptr);
+    test_assert(m_funcs.m_reset_high_water_marks != nullptr);
+    test_assert(m_funcs.m_get_stats != nullptr);
+    test_assert(m_funcs.m_set_latency_tracking != nullptr);
+    test_assert(m_funcs.m_get_latency_tracking != nullptr);
+    test_assert(m_funcs.m_get_latency_stats != nullptr);
+    test_assert(m_funcs.m_set_trace_callback != nullptr);
+    test_assert(m_funcs.m_set_trace_ring_capacity != nullptr);
+    test_assert(m_funcs.m_trace_ring_read != nullptr);
+    test_assert(m_funcs.m_reset_latency_stats != nullptr);
+    test_assert(m_funcs.m_group_alloc != nullptr);
+    test_assert(m_funcs.m_group_free != nullptr);
+    test_assert(m_funcs.m_group_add != nullptr);
+    test_assert(m_funcs.m_group_remove != nullptr);
+    test_assert(m_funcs.m_group_tick != nullptr);
+    test_assert(m_funcs.m_group_next_tick != nullptr);
     test_assert(m_funcs.m_connect_prepare != nullptr);
     test_assert(m_funcs.m_connect_init_config != nullptr);
     test_assert(m_funcs.m_connect_init_config_will != nullptr);
@@ -90,18 +129,36 @@ UnitTestCommonBase::UnitTestCommonBase(const LibFuncs& funcs) :
     test_assert(m_funcs.m_publish_set_resend_attempts != nullptr);    
     test_assert(m_funcs.m_publish_get_resend_attempts != nullptr);      
     test_assert(m_funcs.m_publish_config != nullptr);      
+    test_assert(m_funcs.m_publish_config_payload_source != nullptr);      
     test_assert(m_funcs.m_publish_send != nullptr);  
     test_assert(m_funcs.m_publish_cancel != nullptr);  
     test_assert(m_funcs.m_publish_was_initiated != nullptr);  
     test_assert(m_funcs.m_publish != nullptr);  
     test_assert(m_funcs.m_publish_set_ordering != nullptr);  
     test_assert(m_funcs.m_publish_get_ordering != nullptr);  
+    test_assert(m_funcs.m_publish_init_resend_pacing_config != nullptr);  
+    test_assert(m_funcs.m_publish_set_resend_pacing != nullptr);  
+    test_assert(m_funcs.m_publish_get_resend_pacing != nullptr);  
+    test_assert(m_funcs.m_publish_init_offline_queue_config != nullptr);  
+    test_assert(m_funcs.m_publish_set_offline_queue != nullptr);  
+    test_assert(m_funcs.m_publish_get_offline_queue != nullptr);  
+    test_assert(m_funcs.m_publish_get_priority_stats != nullptr);  
+    test_assert(m_funcs.m_publish_init_restore_config != nullptr);  
+    test_assert(m_funcs.m_publish_restore != nullptr);  
     test_assert(m_funcs.m_set_next_tick_program_callback != nullptr); 
     test_assert(m_funcs.m_set_cancel_next_tick_wait_callback != nullptr); 
     test_assert(m_funcs.m_set_send_output_data_callback != nullptr); 
     test_assert(m_funcs.m_set_broker_disconnect_report_callback != nullptr); 
     test_assert(m_funcs.m_set_message_received_report_callback != nullptr); 
     test_assert(m_funcs.m_set_error_log_callback != nullptr); 
+    test_assert(m_funcs.m_set_session_store_callback != nullptr); 
+    test_assert(m_funcs.m_set_message_chunk_report_callback != nullptr); 
+    test_assert(m_funcs.m_set_topic_prefilter_callback != nullptr);
+    test_assert(m_funcs.m_set_publish_queue_wakeup_callback != nullptr);
+    test_assert(m_funcs.m_publish_queue_set_capacity != nullptr);
+    test_assert(m_funcs.m_publish_queue_get_capacity != nullptr);
+    test_assert(m_funcs.m_publish_enqueue != nullptr);
+    test_assert(m_funcs.m_publish_queue_drain != nullptr);
 }
 
 
@@ -126,6 +183,30 @@ UnitTestCommonBase::UnitTestMessageInfo& UnitTestCommonBase::UnitTestMessageInfo
     assignDataInternal(m_data, other.m_data, other.m_dataLen);
     m_qos = other.m_qos;
     m_retained = other.m_retained;
+    m_topicId = other.m_topicId;
+    return *this;
+}
+
+UnitTestCommonBase::UnitTestMessageChunkInfo& UnitTestCommonBase::UnitTestMessageChunkInfo::operator=(const CC_Mqtt311MessageChunkInfo& other)
+{
+    assignStringInternal(m_topic, other.m_topic);
+    assignDataInternal(m_data, other.m_data, other.m_dataLen);
+    m_offset = other.m_offset;
+    m_totalLen = other.m_totalLen;
+    m_qos = other.m_qos;
+    m_retained = other.m_retained;
+    m_last = other.m_last;
+    return *this;
+}
+
+UnitTestCommonBase::UnitTestSessionStoreRecord& UnitTestCommonBase::UnitTestSessionStoreRecord::operator=(const CC_Mqtt311SessionStoreRecord& other)
+{
+    m_type = other.m_type;
+    m_packetId = other.m_packetId;
+    assignStringInternal(m_topic, other.m_topic);
+    assignDataInternal(m_data, other.m_data, other.m_dataLen);
+    m_qos = other.m_qos;
+    m_retain = other.m_retain;
     return *this;
 }
 
@@ -141,17 +222,31 @@ void UnitTestCommonBase::unitTestTearDown()
 UnitTestCommonBase::UnitTestClientPtr UnitTestCommonBase::apiAllocClient(bool addLog)
 {
     auto client = apiAlloc();
-    if (addLog) {
-        m_funcs.m_set_error_log_callback(client.get(), &UnitTestCommonBase::unitTestErrorLogCb, nullptr);
+    unitTestSetUpClient(client.get(), addLog);
+    return client;
+}
+
+UnitTestCommonBase::UnitTestClientPtr UnitTestCommonBase::apiAllocClientWithAllocator(CC_Mqtt311AllocCb allocCb, CC_Mqtt311FreeCb freeCb, void* data)
+{
+    UnitTestClientPtr client(m_funcs.m_alloc_with_allocator(allocCb, freeCb, data), UnitTestDeleter(m_funcs));
+    if (client) {
+        unitTestSetUpClient(client.get(), false);
     }
-    apiSetBrokerDisconnectReportCb(client.get(), &UnitTestCommonBase::unitTestBrokerDisconnectedCb, this);
-    apiSetMessageReceivedReportCb(client.get(), &UnitTestCommonBase::unitTestMessageReceivedCb, this);
-    apiSetSendOutputDataCb(client.get(), &UnitTestCommonBase::unitTestSendOutputDataCb, this);
-    apiSetNextTickProgramCb(client.get(), &UnitTestCommonBase::unitTestProgramNextTickCb, this);
-    apiSetCancelNextTickWaitCb(client.get(), &UnitTestCommonBase::unitTestCancelNextTickWaitCb, this);
     return client;
 }
 
+void UnitTestCommonBase::unitTestSetUpClient(CC_Mqtt311Client* client, bool addLog)
+{
+    if (addLog) {
+        m_funcs.m_set_error_log_callback(client, &UnitTestCommonBase::unitTestErrorLogCb, nullptr);
+    }
+    apiSetBrokerDisconnectReportCb(client, &UnitTestCommonBase::unitTestBrokerDisconnectedCb, this);
+    apiSetMessageReceivedReportCb(client, &UnitTestCommonBase::unitTestMessageReceivedCb, this);
+    apiSetSendOutputDataCb(client, &UnitTestCommonBase::unitTestSendOutputDataCb, this);
+    apiSetNextTickProgramCb(client, &UnitTestCommonBase::unitTestProgramNextTickCb, this);
+    apiSetCancelNextTickWaitCb(client, &UnitTestCommonBase::unitTestCancelNextTickWaitCb, this);
+}
+
 const UnitTestCommonBase::TickInfo* UnitTestCommonBase::unitTestTickReq()
 {
     test_assert(!m_tickReq.empty());
@@ -322,6 +417,27 @@ void UnitTestCommonBase::unitTestReceiveMessage(CC_Mqtt311Client* client, const
     m_receivedData.erase(m_receivedData.begin(), m_receivedData.begin() + consumed);
 }
 
+unsigned UnitTestCommonBase::unitTestProcessReceivedData(CC_Mqtt311Client* client, unsigned maxLen)
+{
+    test_assert(!m_receivedData.empty());
+    auto len = std::min(maxLen, static_cast<unsigned>(m_receivedData.size()));
+    auto consumed = m_funcs.m_process_data(client, &m_receivedData[0], len);
+    m_receivedData.erase(m_receivedData.begin(), m_receivedData.begin() + consumed);
+    return consumed;
+}
+
+unsigned UnitTestCommonBase::unitTestFeedInputBuffer(CC_Mqtt311Client* client, unsigned maxLen)
+{
+    test_assert(!m_receivedData.empty());
+    unsigned bufLen = 0U;
+    auto* buf = m_funcs.m_input_buffer_acquire(client, &bufLen);
+    test_assert(buf != nullptr);
+    auto len = std::min({maxLen, bufLen, static_cast<unsigned>(m_receivedData.size())});
+    std::copy_n(m_receivedData.begin(), len, buf);
+    m_receivedData.erase(m_receivedData.begin(), m_receivedData.begin() + len);
+    return m_funcs.m_input_buffer_commit(client, len);
+}
+
 bool UnitTestCommonBase::unitTestHasDisconnectInfo() const
 {
     return (!m_disconnectInfo.empty());
@@ -356,6 +472,57 @@ void UnitTestCommonBase::unitTestPopReceivedMessageInfo()
     m_receivedMessages.erase(m_receivedMessages.begin());
 }
 
+void UnitTestCommonBase::unitTestEnableMessageStreaming(CC_Mqtt311Client* client, unsigned threshold)
+{
+    auto ec = m_funcs.m_set_message_streaming_threshold(client, threshold);
+    test_assert(ec == CC_Mqtt311ErrorCode_Success);
+    m_funcs.m_set_message_chunk_report_callback(client, &UnitTestCommonBase::unitTestMessageChunkCb, this);
+}
+
+bool UnitTestCommonBase::unitTestHasMessageChunk() const
+{
+    return (!m_messageChunks.empty());
+}
+
+const UnitTestCommonBase::UnitTestMessageChunkInfo& UnitTestCommonBase::unitTestMessageChunk()
+{
+    test_assert(!m_messageChunks.empty());
+    return m_messageChunks.front();
+}
+
+void UnitTestCommonBase::unitTestPopMessageChunk()
+{
+    test_assert(!m_messageChunks.empty());
+    m_messageChunks.erase(m_messageChunks.begin());
+}
+
+void UnitTestCommonBase::unitTestEnableSessionStore(CC_Mqtt311Client* client)
+{
+    m_funcs.m_set_session_store_callback(client, &UnitTestCommonBase::unitTestSessionStoreCb, this);
+}
+
+bool UnitTestCommonBase::unitTestHasSessionStoreRecord() const
+{
+    return (!m_sessionStoreRecords.empty());
+}
+
+const UnitTestCommonBase::UnitTestSessionStoreRecord& UnitTestCommonBase::unitTestSessionStoreRecord()
+{
+    test_assert(!m_sessionStoreRecords.empty());
+    return m_sessionStoreRecords.front();
+}
+
+void UnitTestCommonBase::unitTestPopSessionStoreRecord()
+{
+    test_assert(!m_sessionStoreRecords.empty());
+    m_sessionStoreRecords.erase(m_sessionStoreRecords.begin());
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::unitTestRestorePublish(CC_Mqtt311Client* client, const CC_Mqtt311PublishRestoreConfig* config)
+{
+    return m_funcs.m_publish_restore(client, config, &UnitTestCommonBase::unitTestPublishCompleteCb, this);
+}
+
 void UnitTestCommonBase::unitTestPerformConnect(
     CC_Mqtt311Client* client, 
     const CC_Mqtt311ConnectConfig* config,
@@ -496,6 +663,36 @@ bool UnitTestCommonBase::apiIsNetworkDisconnected(CC_Mqtt311Client* client)
     return m_funcs.m_is_network_disconnected(client);
 }
 
+unsigned UnitTestCommonBase::apiRequiredBytes(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_required_bytes(client);
+}
+
+unsigned char* UnitTestCommonBase::apiInputBufferAcquire(CC_Mqtt311Client* client, unsigned& len)
+{
+    return m_funcs.m_input_buffer_acquire(client, &len);
+}
+
+unsigned UnitTestCommonBase::apiInputBufferCommit(CC_Mqtt311Client* client, unsigned len)
+{
+    return m_funcs.m_input_buffer_commit(client, len);
+}
+
+void UnitTestCommonBase::apiNotifyOutputBlocked(CC_Mqtt311Client* client)
+{
+    m_funcs.m_notify_output_blocked(client);
+}
+
+void UnitTestCommonBase::apiNotifyOutputWritable(CC_Mqtt311Client* client)
+{
+    m_funcs.m_notify_output_writable(client);
+}
+
+bool UnitTestCommonBase::apiIsOutputBlocked(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_is_output_blocked(client);
+}
+
 CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetDefaultResponseTimeout(CC_Mqtt311Client* client, unsigned ms)
 {
     return m_funcs.m_set_default_response_timeout(client, ms);
@@ -506,6 +703,156 @@ void UnitTestCommonBase::apiSetVerifyIncomingMsgSubscribed(CC_Mqtt311Client* cli
     m_funcs.m_set_verify_incoming_msg_subscribed(client, enabled);
 }
 
+unsigned UnitTestCommonBase::apiGetMessageStreamingThreshold(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_message_streaming_threshold(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetLazyPublishDecode(CC_Mqtt311Client* client, bool enabled)
+{
+    return m_funcs.m_set_lazy_publish_decode(client, enabled);
+}
+
+bool UnitTestCommonBase::apiGetLazyPublishDecode(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_lazy_publish_decode(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetTopicInternLimit(CC_Mqtt311Client* client, unsigned limit)
+{
+    return m_funcs.m_set_topic_intern_limit(client, limit);
+}
+
+unsigned UnitTestCommonBase::apiGetTopicInternLimit(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_topic_intern_limit(client);
+}
+
+const char* UnitTestCommonBase::apiGetInternedTopic(CC_Mqtt311Client* client, unsigned topicId)
+{
+    return m_funcs.m_get_interned_topic(client, topicId);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetMemPoolChunkSize(CC_Mqtt311Client* client, unsigned chunkSize)
+{
+    return m_funcs.m_set_mem_pool_chunk_size(client, chunkSize);
+}
+
+unsigned UnitTestCommonBase::apiGetMemPoolChunkSize(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_mem_pool_chunk_size(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetLeanMode(CC_Mqtt311Client* client, bool enabled)
+{
+    return m_funcs.m_set_lean_mode(client, enabled);
+}
+
+bool UnitTestCommonBase::apiGetLeanMode(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_lean_mode(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGetMemoryFootprint(CC_Mqtt311Client* client, CC_Mqtt311MemoryFootprint* info)
+{
+    return m_funcs.m_get_memory_footprint(client, info);
+}
+
+void UnitTestCommonBase::apiInitOutputBufShrinkConfig(CC_Mqtt311OutputBufShrinkConfig* config)
+{
+    m_funcs.m_init_output_buf_shrink_config(config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetOutputBufShrink(CC_Mqtt311Client* client, const CC_Mqtt311OutputBufShrinkConfig* config)
+{
+    return m_funcs.m_set_output_buf_shrink(client, config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGetOutputBufShrink(CC_Mqtt311Client* client, CC_Mqtt311OutputBufShrinkConfig* config)
+{
+    return m_funcs.m_get_output_buf_shrink(client, config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGetHighWaterMarks(CC_Mqtt311Client* client, CC_Mqtt311HighWaterMarks* marks)
+{
+    return m_funcs.m_get_high_water_marks(client, marks);
+}
+
+void UnitTestCommonBase::apiResetHighWaterMarks(CC_Mqtt311Client* client)
+{
+    m_funcs.m_reset_high_water_marks(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGetStats(CC_Mqtt311Client* client, CC_Mqtt311ClientStats* stats)
+{
+    return m_funcs.m_get_stats(client, stats);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetLatencyTracking(CC_Mqtt311Client* client, bool enabled)
+{
+    return m_funcs.m_set_latency_tracking(client, enabled);
+}
+
+bool UnitTestCommonBase::apiGetLatencyTracking(CC_Mqtt311Client* client)
+{
+    return m_funcs.m_get_latency_tracking(client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGetLatencyStats(CC_Mqtt311Client* client, CC_Mqtt311LatencyType type, CC_Mqtt311LatencyStats* stats)
+{
+    return m_funcs.m_get_latency_stats(client, type, stats);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetTraceCallback(CC_Mqtt311Client* client, CC_Mqtt311TraceCb cb, void* data)
+{
+    return m_funcs.m_set_trace_callback(client, cb, data);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiSetTraceRingCapacity(CC_Mqtt311Client* client, unsigned capacity)
+{
+    return m_funcs.m_set_trace_ring_capacity(client, capacity);
+}
+
+unsigned UnitTestCommonBase::apiTraceRingRead(CC_Mqtt311Client* client, CC_Mqtt311TraceRecord* records, unsigned maxCount)
+{
+    return m_funcs.m_trace_ring_read(client, records, maxCount);
+}
+
+void UnitTestCommonBase::apiResetLatencyStats(CC_Mqtt311Client* client)
+{
+    m_funcs.m_reset_latency_stats(client);
+}
+
+CC_Mqtt311ClientGroupHandle UnitTestCommonBase::apiGroupAlloc()
+{
+    return m_funcs.m_group_alloc();
+}
+
+void UnitTestCommonBase::apiGroupFree(CC_Mqtt311ClientGroupHandle group)
+{
+    m_funcs.m_group_free(group);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGroupAdd(CC_Mqtt311ClientGroupHandle group, CC_Mqtt311Client* client)
+{
+    return m_funcs.m_group_add(group, client);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiGroupRemove(CC_Mqtt311ClientGroupHandle group, CC_Mqtt311Client* client)
+{
+    return m_funcs.m_group_remove(group, client);
+}
+
+unsigned UnitTestCommonBase::apiGroupTick(CC_Mqtt311ClientGroupHandle group, unsigned ms)
+{
+    return m_funcs.m_group_tick(group, ms);
+}
+
+unsigned UnitTestCommonBase::apiGroupNextTick(CC_Mqtt311ClientGroupHandle group)
+{
+    return m_funcs.m_group_next_tick(group);
+}
+
 CC_Mqtt311ConnectHandle UnitTestCommonBase::apiConnectPrepare(CC_Mqtt311Client* client, CC_Mqtt311ErrorCode* ec)
 {
     return m_funcs.m_connect_prepare(client, ec);
@@ -611,6 +958,11 @@ CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishConfig(CC_Mqtt311PublishHandle
     return m_funcs.m_publish_config(handle, config);
 }
 
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishConfigPayloadSource(CC_Mqtt311PublishHandle handle, unsigned dataLen, CC_Mqtt311PublishPayloadReadCb cb, void* cbData)
+{
+    return m_funcs.m_publish_config_payload_source(handle, dataLen, cb, cbData);
+}
+
 CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishCancel(CC_Mqtt311PublishHandle handle)
 {
     return m_funcs.m_publish_cancel(handle);
@@ -631,6 +983,46 @@ CC_Mqtt311PublishOrdering UnitTestCommonBase::apiPublishGetOrdering(CC_Mqtt311Cl
     return m_funcs.m_publish_get_ordering(handle);
 }
 
+void UnitTestCommonBase::apiPublishInitResendPacingConfig(CC_Mqtt311ResendPacingConfig* config)
+{
+    return m_funcs.m_publish_init_resend_pacing_config(config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishSetResendPacing(CC_Mqtt311ClientHandle handle, const CC_Mqtt311ResendPacingConfig* config)
+{
+    return m_funcs.m_publish_set_resend_pacing(handle, config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishGetResendPacing(CC_Mqtt311ClientHandle handle, CC_Mqtt311ResendPacingConfig* config)
+{
+    return m_funcs.m_publish_get_resend_pacing(handle, config);
+}
+
+void UnitTestCommonBase::apiPublishInitOfflineQueueConfig(CC_Mqtt311OfflineQueueConfig* config)
+{
+    return m_funcs.m_publish_init_offline_queue_config(config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishSetOfflineQueue(CC_Mqtt311ClientHandle handle, const CC_Mqtt311OfflineQueueConfig* config)
+{
+    return m_funcs.m_publish_set_offline_queue(handle, config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishGetOfflineQueue(CC_Mqtt311ClientHandle handle, CC_Mqtt311OfflineQueueConfig* config)
+{
+    return m_funcs.m_publish_get_offline_queue(handle, config);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishGetPriorityStats(CC_Mqtt311ClientHandle handle, CC_Mqtt311PublishPriority priority, CC_Mqtt311PublishPriorityStats* stats)
+{
+    return m_funcs.m_publish_get_priority_stats(handle, priority, stats);
+}
+
+void UnitTestCommonBase::apiPublishInitRestoreConfig(CC_Mqtt311PublishRestoreConfig* config)
+{
+    return m_funcs.m_publish_init_restore_config(config);
+}
+
 void UnitTestCommonBase::apiSetNextTickProgramCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311NextTickProgramCb cb, void* data)
 {
     return m_funcs.m_set_next_tick_program_callback(handle, cb, data);
@@ -656,6 +1048,36 @@ void UnitTestCommonBase::apiSetMessageReceivedReportCb(CC_Mqtt311ClientHandle ha
     return m_funcs.m_set_message_received_report_callback(handle, cb, data);
 }
 
+void UnitTestCommonBase::apiSetTopicPrefilterCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311TopicPrefilterCb cb, void* data)
+{
+    return m_funcs.m_set_topic_prefilter_callback(handle, cb, data);
+}
+
+void UnitTestCommonBase::apiSetPublishQueueWakeupCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311PublishQueueWakeupCb cb, void* data)
+{
+    m_funcs.m_set_publish_queue_wakeup_callback(handle, cb, data);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishQueueSetCapacity(CC_Mqtt311ClientHandle handle, unsigned capacity)
+{
+    return m_funcs.m_publish_queue_set_capacity(handle, capacity);
+}
+
+unsigned UnitTestCommonBase::apiPublishQueueGetCapacity(CC_Mqtt311ClientHandle handle)
+{
+    return m_funcs.m_publish_queue_get_capacity(handle);
+}
+
+CC_Mqtt311ErrorCode UnitTestCommonBase::apiPublishEnqueue(CC_Mqtt311ClientHandle handle, const CC_Mqtt311PublishConfig* config, bool copyData, CC_Mqtt311PublishCompleteCb cb, void* cbData)
+{
+    return m_funcs.m_publish_enqueue(handle, config, copyData, cb, cbData);
+}
+
+unsigned UnitTestCommonBase::apiPublishQueueDrain(CC_Mqtt311ClientHandle handle)
+{
+    return m_funcs.m_publish_queue_drain(handle);
+}
+
 void UnitTestCommonBase::unitTestErrorLogCb([[maybe_unused]] void* obj, const char* msg)
 {
     std::cout << "ERROR: " << msg << std::endl;
@@ -740,3 +1162,19 @@ void UnitTestCommonBase::unitTestPublishCompleteCb(void* obj, [[maybe_unused]] C
     auto& info = realObj->m_publishResp.back();
     info.m_status = status;
 }
+
+void UnitTestCommonBase::unitTestSessionStoreCb(void* obj, const CC_Mqtt311SessionStoreRecord* record)
+{
+    test_assert(record != nullptr);
+    auto* realObj = reinterpret_cast<UnitTestCommonBase*>(obj);
+    realObj->m_sessionStoreRecords.resize(realObj->m_sessionStoreRecords.size() + 1U);
+    realObj->m_sessionStoreRecords.back() = *record;
+}
+
+void UnitTestCommonBase::unitTestMessageChunkCb(void* obj, const CC_Mqtt311MessageChunkInfo* info)
+{
+    test_assert(info != nullptr);
+    auto* realObj = reinterpret_cast<UnitTestCommonBase*>(obj);
+    realObj->m_messageChunks.resize(realObj->m_messageChunks.size() + 1U);
+    realObj->m_messageChunks.back() = *info;
+}
@@ -20,11 +20,18 @@ public:
     struct LibFuncs
     {
         CC_Mqtt311ClientHandle (*m_alloc)() = nullptr;
+        CC_Mqtt311ClientHandle (*m_alloc_with_allocator)(CC_Mqtt311AllocCb, CC_Mqtt311FreeCb, void*) = nullptr;
         void (*m_free)(CC_Mqtt311ClientHandle) = nullptr;
         void (*m_tick)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
         unsigned (*m_process_data)(CC_Mqtt311ClientHandle, const unsigned char*, unsigned) = nullptr;
+        unsigned (*m_required_bytes)(CC_Mqtt311ClientHandle) = nullptr;
+        unsigned char* (*m_input_buffer_acquire)(CC_Mqtt311ClientHandle, unsigned*) = nullptr;
+        unsigned (*m_input_buffer_commit)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
         void (*m_notify_network_disconnected)(CC_Mqtt311ClientHandle) = nullptr;
         bool (*m_is_network_disconnected)(CC_Mqtt311ClientHandle) = nullptr;
+        void (*m_notify_output_blocked)(CC_Mqtt311ClientHandle) = nullptr;
+        void (*m_notify_output_writable)(CC_Mqtt311ClientHandle) = nullptr;
+        bool (*m_is_output_blocked)(CC_Mqtt311ClientHandle) = nullptr;
         CC_Mqtt311ErrorCode (*m_set_default_response_timeout)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
         unsigned (*m_get_default_response_timeout)(CC_Mqtt311ClientHandle) = nullptr;
         CC_Mqtt311ErrorCode (*m_pub_topic_alias_alloc)(CC_Mqtt311ClientHandle, const char*, unsigned) = nullptr;
@@ -37,6 +44,37 @@ public:
         bool (*m_get_verify_incoming_topic_enabled)(CC_Mqtt311ClientHandle) = nullptr;
         CC_Mqtt311ErrorCode (*m_set_verify_incoming_msg_subscribed)(CC_Mqtt311ClientHandle, bool) = nullptr;
         bool (*m_get_verify_incoming_msg_subscribed)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_message_streaming_threshold)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        unsigned (*m_get_message_streaming_threshold)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_lazy_publish_decode)(CC_Mqtt311ClientHandle, bool) = nullptr;
+        bool (*m_get_lazy_publish_decode)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_topic_intern_limit)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        unsigned (*m_get_topic_intern_limit)(CC_Mqtt311ClientHandle) = nullptr;
+        const char* (*m_get_interned_topic)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_mem_pool_chunk_size)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        unsigned (*m_get_mem_pool_chunk_size)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_lean_mode)(CC_Mqtt311ClientHandle, bool) = nullptr;
+        bool (*m_get_lean_mode)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_get_memory_footprint)(CC_Mqtt311ClientHandle, CC_Mqtt311MemoryFootprint*) = nullptr;
+        void (*m_init_output_buf_shrink_config)(CC_Mqtt311OutputBufShrinkConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_output_buf_shrink)(CC_Mqtt311ClientHandle, const CC_Mqtt311OutputBufShrinkConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_get_output_buf_shrink)(CC_Mqtt311ClientHandle, CC_Mqtt311OutputBufShrinkConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_get_high_water_marks)(CC_Mqtt311ClientHandle, CC_Mqtt311HighWaterMarks*) = nullptr;
+        void (*m_reset_high_water_marks)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_get_stats)(CC_Mqtt311ClientHandle, CC_Mqtt311ClientStats*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_latency_tracking)(CC_Mqtt311ClientHandle, bool) = nullptr;
+        bool (*m_get_latency_tracking)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_get_latency_stats)(CC_Mqtt311ClientHandle, CC_Mqtt311LatencyType, CC_Mqtt311LatencyStats*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_trace_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311TraceCb, void*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_set_trace_ring_capacity)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        unsigned (*m_trace_ring_read)(CC_Mqtt311ClientHandle, CC_Mqtt311TraceRecord*, unsigned) = nullptr;
+        void (*m_reset_latency_stats)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ClientGroupHandle (*m_group_alloc)() = nullptr;
+        void (*m_group_free)(CC_Mqtt311ClientGroupHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_group_add)(CC_Mqtt311ClientGroupHandle, CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_group_remove)(CC_Mqtt311ClientGroupHandle, CC_Mqtt311ClientHandle) = nullptr;
+        unsigned (*m_group_tick)(CC_Mqtt311ClientGroupHandle, unsigned) = nullptr;
+        unsigned (*m_group_next_tick)(CC_Mqtt311ClientGroupHandle) = nullptr;
         CC_Mqtt311ConnectHandle (*m_connect_prepare)(CC_Mqtt311ClientHandle, CC_Mqtt311ErrorCode*) = nullptr;
         void (*m_connect_init_config)(CC_Mqtt311ConnectConfig*) = nullptr;
         void (*m_connect_init_config_will)(CC_Mqtt311ConnectWillConfig*) = nullptr;
@@ -76,18 +114,36 @@ public:
         CC_Mqtt311ErrorCode (*m_publish_set_resend_attempts)(CC_Mqtt311PublishHandle, unsigned) = nullptr;
         unsigned (*m_publish_get_resend_attempts)(CC_Mqtt311PublishHandle) = nullptr;
         CC_Mqtt311ErrorCode (*m_publish_config)(CC_Mqtt311PublishHandle, const CC_Mqtt311PublishConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_config_payload_source)(CC_Mqtt311PublishHandle, unsigned, CC_Mqtt311PublishPayloadReadCb, void*) = nullptr;
         CC_Mqtt311ErrorCode (*m_publish_send)(CC_Mqtt311PublishHandle, CC_Mqtt311PublishCompleteCb, void*) = nullptr;
         CC_Mqtt311ErrorCode (*m_publish_cancel)(CC_Mqtt311PublishHandle) = nullptr;
         bool (*m_publish_was_initiated)(CC_Mqtt311PublishHandle) = nullptr;
         CC_Mqtt311ErrorCode (*m_publish)(CC_Mqtt311ClientHandle, const CC_Mqtt311PublishConfig*, CC_Mqtt311PublishCompleteCb, void*) = nullptr;
         CC_Mqtt311ErrorCode (*m_publish_set_ordering)(CC_Mqtt311ClientHandle, CC_Mqtt311PublishOrdering) = nullptr;
         CC_Mqtt311PublishOrdering (*m_publish_get_ordering)(CC_Mqtt311ClientHandle) = nullptr;
+        void (*m_publish_init_resend_pacing_config)(CC_Mqtt311ResendPacingConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_set_resend_pacing)(CC_Mqtt311ClientHandle, const CC_Mqtt311ResendPacingConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_get_resend_pacing)(CC_Mqtt311ClientHandle, CC_Mqtt311ResendPacingConfig*) = nullptr;
+        void (*m_publish_init_offline_queue_config)(CC_Mqtt311OfflineQueueConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_set_offline_queue)(CC_Mqtt311ClientHandle, const CC_Mqtt311OfflineQueueConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_get_offline_queue)(CC_Mqtt311ClientHandle, CC_Mqtt311OfflineQueueConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_get_priority_stats)(CC_Mqtt311ClientHandle, CC_Mqtt311PublishPriority, CC_Mqtt311PublishPriorityStats*) = nullptr;
+        void (*m_publish_init_restore_config)(CC_Mqtt311PublishRestoreConfig*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_restore)(CC_Mqtt311ClientHandle, const CC_Mqtt311PublishRestoreConfig*, CC_Mqtt311PublishCompleteCb, void*) = nullptr;
         void (*m_set_next_tick_program_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311NextTickProgramCb, void*) = nullptr;
         void (*m_set_cancel_next_tick_wait_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311CancelNextTickWaitCb, void*) = nullptr;        
         void (*m_set_send_output_data_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311SendOutputDataCb, void*) = nullptr;
         void (*m_set_broker_disconnect_report_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311BrokerDisconnectReportCb, void*) = nullptr;        
         void (*m_set_message_received_report_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311MessageReceivedReportCb, void*) = nullptr;        
         void (*m_set_error_log_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311ErrorLogCb, void*) = nullptr;        
+        void (*m_set_session_store_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311SessionStoreCb, void*) = nullptr;        
+        void (*m_set_message_chunk_report_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311MessageChunkReportCb, void*) = nullptr;        
+        void (*m_set_topic_prefilter_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311TopicPrefilterCb, void*) = nullptr;
+        void (*m_set_publish_queue_wakeup_callback)(CC_Mqtt311ClientHandle, CC_Mqtt311PublishQueueWakeupCb, void*) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_queue_set_capacity)(CC_Mqtt311ClientHandle, unsigned) = nullptr;
+        unsigned (*m_publish_queue_get_capacity)(CC_Mqtt311ClientHandle) = nullptr;
+        CC_Mqtt311ErrorCode (*m_publish_enqueue)(CC_Mqtt311ClientHandle, const CC_Mqtt311PublishConfig*, bool, CC_Mqtt311PublishCompleteCb, void*) = nullptr;
+        unsigned (*m_publish_queue_drain)(CC_Mqtt311ClientHandle) = nullptr;
     };
 
     struct UnitTestDeleter
@@ -164,6 +220,7 @@ protected:
         UnitTestData m_data;
         CC_Mqtt311QoS m_qos = CC_Mqtt311QoS_ValuesLimit;
         bool m_retained = false;     
+        unsigned m_topicId = 0U;
 
         UnitTestMessageInfo() = default;
         UnitTestMessageInfo(const UnitTestMessageInfo&) = default;
@@ -177,6 +234,31 @@ protected:
         UnitTestMessageInfo& operator=(const CC_Mqtt311MessageInfo& other);        
     };    
 
+    struct UnitTestMessageChunkInfo
+    {
+        std::string m_topic;
+        UnitTestData m_data;
+        unsigned m_offset = 0U;
+        unsigned m_totalLen = 0U;
+        CC_Mqtt311QoS m_qos = CC_Mqtt311QoS_ValuesLimit;
+        bool m_retained = false;
+        bool m_last = false;
+
+        UnitTestMessageChunkInfo& operator=(const CC_Mqtt311MessageChunkInfo& other);
+    };
+
+    struct UnitTestSessionStoreRecord
+    {
+        CC_Mqtt311SessionStoreRecordType m_type = CC_Mqtt311SessionStoreRecordType_ValuesLimit;
+        unsigned m_packetId = 0U;
+        std::string m_topic;
+        UnitTestData m_data;
+        CC_Mqtt311QoS m_qos = CC_Mqtt311QoS_ValuesLimit;
+        bool m_retain = false;
+
+        UnitTestSessionStoreRecord& operator=(const CC_Mqtt311SessionStoreRecord& other);
+    };
+
     struct UnitTestPublishResponseInfo
     {
         CC_Mqtt311AsyncOpStatus m_status = CC_Mqtt311AsyncOpStatus_ValuesLimit;
@@ -202,6 +284,7 @@ protected:
     void unitTestSetUp();
     void unitTestTearDown();
     UnitTestClientPtr apiAllocClient(bool addLog = false);
+    UnitTestClientPtr apiAllocClientWithAllocator(CC_Mqtt311AllocCb allocCb, CC_Mqtt311FreeCb freeCb, void* data);
 
     decltype(auto) unitTestSentData()
     {
@@ -230,12 +313,23 @@ protected:
     const UnitTestPublishResponseInfo& unitTestPublishResponseInfo();
     void unitTestPopPublishResponseInfo();
     void unitTestReceiveMessage(CC_Mqtt311Client* client, const UnitTestMessage& msg, bool reportReceivedData = true);
+    unsigned unitTestProcessReceivedData(CC_Mqtt311Client* client, unsigned maxLen);
+    unsigned unitTestFeedInputBuffer(CC_Mqtt311Client* client, unsigned maxLen);
     bool unitTestHasDisconnectInfo() const;
     const UnitTestDisconnectInfo& unitTestDisconnectInfo() const;
     void unitTestPopDisconnectInfo();
     bool unitTestHasMessageRecieved();
     const UnitTestMessageInfo& unitTestReceivedMessageInfo();
     void unitTestPopReceivedMessageInfo();      
+    void unitTestEnableMessageStreaming(CC_Mqtt311Client* client, unsigned threshold);
+    bool unitTestHasMessageChunk() const;
+    const UnitTestMessageChunkInfo& unitTestMessageChunk();
+    void unitTestPopMessageChunk();
+    void unitTestEnableSessionStore(CC_Mqtt311Client* client);
+    bool unitTestHasSessionStoreRecord() const;
+    const UnitTestSessionStoreRecord& unitTestSessionStoreRecord();
+    void unitTestPopSessionStoreRecord();
+    CC_Mqtt311ErrorCode unitTestRestorePublish(CC_Mqtt311Client* client, const CC_Mqtt311PublishRestoreConfig* config);
     void unitTestPerformConnect(
         CC_Mqtt311Client* client, 
         const CC_Mqtt311ConnectConfig* config,
@@ -263,8 +357,44 @@ protected:
     UnitTestClientPtr apiAlloc();
     void apiNotifyNetworkDisconnected(CC_Mqtt311Client* client);
     bool apiIsNetworkDisconnected(CC_Mqtt311Client* client);
+    unsigned apiRequiredBytes(CC_Mqtt311Client* client);
+    unsigned char* apiInputBufferAcquire(CC_Mqtt311Client* client, unsigned& len);
+    unsigned apiInputBufferCommit(CC_Mqtt311Client* client, unsigned len);
+    void apiNotifyOutputBlocked(CC_Mqtt311Client* client);
+    void apiNotifyOutputWritable(CC_Mqtt311Client* client);
+    bool apiIsOutputBlocked(CC_Mqtt311Client* client);
     CC_Mqtt311ErrorCode apiSetDefaultResponseTimeout(CC_Mqtt311Client* client, unsigned ms);
     void apiSetVerifyIncomingMsgSubscribed(CC_Mqtt311Client* client, bool enabled);
+    unsigned apiGetMessageStreamingThreshold(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiSetLazyPublishDecode(CC_Mqtt311Client* client, bool enabled);
+    bool apiGetLazyPublishDecode(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiSetTopicInternLimit(CC_Mqtt311Client* client, unsigned limit);
+    unsigned apiGetTopicInternLimit(CC_Mqtt311Client* client);
+    const char* apiGetInternedTopic(CC_Mqtt311Client* client, unsigned topicId);
+    CC_Mqtt311ErrorCode apiSetMemPoolChunkSize(CC_Mqtt311Client* client, unsigned chunkSize);
+    unsigned apiGetMemPoolChunkSize(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiSetLeanMode(CC_Mqtt311Client* client, bool enabled);
+    bool apiGetLeanMode(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiGetMemoryFootprint(CC_Mqtt311Client* client, CC_Mqtt311MemoryFootprint* info);
+    void apiInitOutputBufShrinkConfig(CC_Mqtt311OutputBufShrinkConfig* config);
+    CC_Mqtt311ErrorCode apiSetOutputBufShrink(CC_Mqtt311Client* client, const CC_Mqtt311OutputBufShrinkConfig* config);
+    CC_Mqtt311ErrorCode apiGetOutputBufShrink(CC_Mqtt311Client* client, CC_Mqtt311OutputBufShrinkConfig* config);
+    CC_Mqtt311ErrorCode apiGetHighWaterMarks(CC_Mqtt311Client* client, CC_Mqtt311HighWaterMarks* marks);
+    void apiResetHighWaterMarks(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiGetStats(CC_Mqtt311Client* client, CC_Mqtt311ClientStats* stats);
+    CC_Mqtt311ErrorCode apiSetLatencyTracking(CC_Mqtt311Client* client, bool enabled);
+    bool apiGetLatencyTracking(CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiGetLatencyStats(CC_Mqtt311Client* client, CC_Mqtt311LatencyType type, CC_Mqtt311LatencyStats* stats);
+    CC_Mqtt311ErrorCode apiSetTraceCallback(CC_Mqtt311Client* client, CC_Mqtt311TraceCb cb, void* data);
+    CC_Mqtt311ErrorCode apiSetTraceRingCapacity(CC_Mqtt311Client* client, unsigned capacity);
+    unsigned apiTraceRingRead(CC_Mqtt311Client* client, CC_Mqtt311TraceRecord* records, unsigned maxCount);
+    void apiResetLatencyStats(CC_Mqtt311Client* client);
+    CC_Mqtt311ClientGroupHandle apiGroupAlloc();
+    void apiGroupFree(CC_Mqtt311ClientGroupHandle group);
+    CC_Mqtt311ErrorCode apiGroupAdd(CC_Mqtt311ClientGroupHandle group, CC_Mqtt311Client* client);
+    CC_Mqtt311ErrorCode apiGroupRemove(CC_Mqtt311ClientGroupHandle group, CC_Mqtt311Client* client);
+    unsigned apiGroupTick(CC_Mqtt311ClientGroupHandle group, unsigned ms);
+    unsigned apiGroupNextTick(CC_Mqtt311ClientGroupHandle group);
     CC_Mqtt311ConnectHandle apiConnectPrepare(CC_Mqtt311Client* client, CC_Mqtt311ErrorCode* ec);
     void apiConnectInitConfig(CC_Mqtt311ConnectConfig* config);
     void apiConnectInitConfigWill(CC_Mqtt311ConnectWillConfig* config);
@@ -286,17 +416,33 @@ protected:
     void apiPublishInitConfig(CC_Mqtt311PublishConfig* config);
     CC_Mqtt311ErrorCode apiPublishSetResponseTimeout(CC_Mqtt311PublishHandle handle, unsigned ms);
     CC_Mqtt311ErrorCode apiPublishConfig(CC_Mqtt311PublishHandle handle, const CC_Mqtt311PublishConfig* config);
+    CC_Mqtt311ErrorCode apiPublishConfigPayloadSource(CC_Mqtt311PublishHandle handle, unsigned dataLen, CC_Mqtt311PublishPayloadReadCb cb, void* cbData);
     CC_Mqtt311ErrorCode apiPublishCancel(CC_Mqtt311PublishHandle handle);
     bool apiPublishWasInitiated(CC_Mqtt311PublishHandle handle);
     CC_Mqtt311ErrorCode apiPublishSetOrdering(CC_Mqtt311ClientHandle handle, CC_Mqtt311PublishOrdering ordering);
     CC_Mqtt311PublishOrdering apiPublishGetOrdering(CC_Mqtt311ClientHandle handle);
+    void apiPublishInitResendPacingConfig(CC_Mqtt311ResendPacingConfig* config);
+    CC_Mqtt311ErrorCode apiPublishSetResendPacing(CC_Mqtt311ClientHandle handle, const CC_Mqtt311ResendPacingConfig* config);
+    CC_Mqtt311ErrorCode apiPublishGetResendPacing(CC_Mqtt311ClientHandle handle, CC_Mqtt311ResendPacingConfig* config);
+    void apiPublishInitOfflineQueueConfig(CC_Mqtt311OfflineQueueConfig* config);
+    CC_Mqtt311ErrorCode apiPublishSetOfflineQueue(CC_Mqtt311ClientHandle handle, const CC_Mqtt311OfflineQueueConfig* config);
+    CC_Mqtt311ErrorCode apiPublishGetOfflineQueue(CC_Mqtt311ClientHandle handle, CC_Mqtt311OfflineQueueConfig* config);
+    CC_Mqtt311ErrorCode apiPublishGetPriorityStats(CC_Mqtt311ClientHandle handle, CC_Mqtt311PublishPriority priority, CC_Mqtt311PublishPriorityStats* stats);
+    void apiPublishInitRestoreConfig(CC_Mqtt311PublishRestoreConfig* config);
     void apiSetNextTickProgramCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311NextTickProgramCb cb, void* data);    
     void apiSetCancelNextTickWaitCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311CancelNextTickWaitCb cb, void* data);    
     void apiSetSendOutputDataCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311SendOutputDataCb cb, void* data);    
     void apiSetBrokerDisconnectReportCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311BrokerDisconnectReportCb cb, void* data);    
     void apiSetMessageReceivedReportCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311MessageReceivedReportCb cb, void* data);    
+    void apiSetTopicPrefilterCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311TopicPrefilterCb cb, void* data);
+    void apiSetPublishQueueWakeupCb(CC_Mqtt311ClientHandle handle, CC_Mqtt311PublishQueueWakeupCb cb, void* data);
+    CC_Mqtt311ErrorCode apiPublishQueueSetCapacity(CC_Mqtt311ClientHandle handle, unsigned capacity);
+    unsigned apiPublishQueueGetCapacity(CC_Mqtt311ClientHandle handle);
+    CC_Mqtt311ErrorCode apiPublishEnqueue(CC_Mqtt311ClientHandle handle, const CC_Mqtt311PublishConfig* config, bool copyData, CC_Mqtt311PublishCompleteCb cb, void* cbData);
+    unsigned apiPublishQueueDrain(CC_Mqtt311ClientHandle handle);
 
 private:
+    void unitTestSetUpClient(CC_Mqtt311Client* client, bool addLog);
 
     static void unitTestErrorLogCb(void* obj, const char* msg);
     static void unitTestBrokerDisconnectedCb(void* obj, CC_Mqtt311BrokerDisconnectReason reason);
@@ -308,6 +454,8 @@ private:
     static void unitTestSubscribeCompleteCb(void* obj, CC_Mqtt311SubscribeHandle handle, CC_Mqtt311AsyncOpStatus status, const CC_Mqtt311SubscribeResponse* response);
     static void unitTestUnsubscribeCompleteCb(void* obj, CC_Mqtt311UnsubscribeHandle handle, CC_Mqtt311AsyncOpStatus status);
     static void unitTestPublishCompleteCb(void* obj, CC_Mqtt311PublishHandle handle, CC_Mqtt311AsyncOpStatus status);
+    static void unitTestSessionStoreCb(void* obj, const CC_Mqtt311SessionStoreRecord* record);
+    static void unitTestMessageChunkCb(void* obj, const CC_Mqtt311MessageChunkInfo* info);
 
     LibFuncs m_funcs;  
     std::vector<TickInfo> m_tickReq;
@@ -319,4 +467,6 @@ private:
     std::vector<UnitTestPublishResponseInfo> m_publishResp;
     std::vector<UnitTestDisconnectInfo> m_disconnectInfo;
     std::vector<UnitTestMessageInfo> m_receivedMessages;
+    std::vector<UnitTestSessionStoreRecord> m_sessionStoreRecords;
+    std::vector<UnitTestMessageChunkInfo> m_messageChunks;
 };
\ No newline at end of file
@@ -6,11 +6,18 @@ const UnitTestDefaultBase::LibFuncs& UnitTestDefaultBase::getFuncs()
 {
     static LibFuncs funcs;
     funcs.m_alloc = &cc_mqtt311_client_alloc;
+    funcs.m_alloc_with_allocator = &cc_mqtt311_client_alloc_with_allocator;
     funcs.m_free = &cc_mqtt311_client_free;
     funcs.m_tick = &cc_mqtt311_client_tick;
     funcs.m_process_data = &cc_mqtt311_client_process_data;
+    funcs.m_required_bytes = &cc_mqtt311_client_required_bytes;
+    funcs.m_input_buffer_acquire = &cc_mqtt311_client_input_buffer_acquire;
+    funcs.m_input_buffer_commit = &cc_mqtt311_client_input_buffer_commit;
     funcs.m_notify_network_disconnected = &cc_mqtt311_client_notify_network_disconnected;
     funcs.m_is_network_disconnected = &cc_mqtt311_client_is_network_disconnected;
+    funcs.m_notify_output_blocked = &cc_mqtt311_client_notify_output_blocked;
+    funcs.m_notify_output_writable = &cc_mqtt311_client_notify_output_writable;
+    funcs.m_is_output_blocked = &cc_mqtt311_client_is_output_blocked;
     funcs.m_set_default_response_timeout = &cc_mqtt311_client_set_default_response_timeout;
     funcs.m_get_default_response_timeout = &cc_mqtt311_client_get_default_response_timeout;
     funcs.m_set_verify_outgoing_topic_enabled = &cc_mqtt311_client_set_verify_outgoing_topic_enabled;
@@ -19,6 +26,37 @@ const UnitTestDefaultBase::LibFuncs& UnitTestDefaultBase::getFuncs()
     funcs.m_get_verify_incoming_topic_enabled = &cc_mqtt311_client_get_verify_incoming_topic_enabled;
     funcs.m_set_verify_incoming_msg_subscribed = &cc_mqtt311_client_set_verify_incoming_msg_subscribed;
     funcs.m_get_verify_incoming_msg_subscribed = &cc_mqtt311_client_get_verify_incoming_msg_subscribed;
+    funcs.m_set_message_streaming_threshold = &cc_mqtt311_client_set_message_streaming_threshold;
+    funcs.m_get_message_streaming_threshold = &cc_mqtt311_client_get_message_streaming_threshold;
+    funcs.m_set_lazy_publish_decode = &cc_mqtt311_client_set_lazy_publish_decode;
+    funcs.m_get_lazy_publish_decode = &cc_mqtt311_client_get_lazy_publish_decode;
+    funcs.m_set_topic_intern_limit = &cc_mqtt311_client_set_topic_intern_limit;
+    funcs.m_get_topic_intern_limit = &cc_mqtt311_client_get_topic_intern_limit;
+    funcs.m_get_interned_topic = &cc_mqtt311_client_get_interned_topic;
+    funcs.m_set_mem_pool_chunk_size = &cc_mqtt311_client_set_mem_pool_chunk_size;
+    funcs.m_get_mem_pool_chunk_size = &cc_mqtt311_client_get_mem_pool_chunk_size;
+    funcs.m_set_lean_mode = &cc_mqtt311_client_set_lean_mode;
+    funcs.m_get_lean_mode = &cc_mqtt311_client_get_lean_mode;
+    funcs.m_get_memory_footprint = &cc_mqtt311_client_get_memory_footprint;
+    funcs.m_init_output_buf_shrink_config = &cc_mqtt311_client_init_output_buf_shrink_config;
+    funcs.m_set_output_buf_shrink = &cc_mqtt311_client_set_output_buf_shrink;
+    funcs.m_get_output_buf_shrink = &cc_mqtt311_client_get_output_buf_shrink;
+    funcs.m_get_high_water_marks = &cc_mqtt311_client_get_high_water_marks;
+    funcs.m_reset_high_water_marks = &cc_mqtt311_client_reset_high_water_marks;
+    funcs.m_get_stats = &cc_mqtt311_client_get_stats;
+    funcs.m_set_latency_tracking = &cc_mqtt311_client_set_latency_tracking;
+    funcs.m_get_latency_tracking = &cc_mqtt311_client_get_latency_tracking;
+    funcs.m_get_latency_stats = &cc_mqtt311_client_get_latency_stats;
+    funcs.m_set_trace_callback = &cc_mqtt311_client_set_trace_callback;
+    funcs.m_set_trace_ring_capacity = &cc_mqtt311_client_set_trace_ring_capacity;
+    funcs.m_trace_ring_read = &cc_mqtt311_client_trace_ring_read;
+    funcs.m_reset_latency_stats = &cc_mqtt311_client_reset_latency_stats;
+    funcs.m_group_alloc = &cc_mqtt311_client_group_alloc;
+    funcs.m_group_free = &cc_mqtt311_client_group_free;
+    funcs.m_group_add = &cc_mqtt311_client_group_add;
+    funcs.m_group_remove = &cc_mqtt311_client_group_remove;
+    funcs.m_group_tick = &cc_mqtt311_client_group_tick;
+    funcs.m_group_next_tick = &cc_mqtt311_client_group_next_tick;
     funcs.m_connect_prepare = &cc_mqtt311_client_connect_prepare;
     funcs.m_connect_init_config = &cc_mqtt311_client_connect_init_config;
     funcs.m_connect_init_config_will = &cc_mqtt311_client_connect_init_config_will;
@@ -58,17 +96,35 @@ const UnitTestDefaultBase::LibFuncs& UnitTestDefaultBase::getFuncs()
     funcs.m_publish_set_resend_attempts = &cc_mqtt311_client_publish_set_resend_attempts;
     funcs.m_publish_get_resend_attempts = &cc_mqtt311_client_publish_get_resend_attempts;
     funcs.m_publish_config = &cc_mqtt311_client_publish_config;
+    funcs.m_publish_config_payload_source = &cc_mqtt311_client_publish_config_payload_source;
     funcs.m_publish_send = &cc_mqtt311_client_publish_send;
     funcs.m_publish_cancel = &cc_mqtt311_client_publish_cancel;    
     funcs.m_publish_was_initiated = &cc_mqtt311_client_publish_was_initiated;    
     funcs.m_publish = &cc_mqtt311_client_publish;    
     funcs.m_publish_set_ordering = &cc_mqtt311_client_publish_set_ordering;
     funcs.m_publish_get_ordering = &cc_mqtt311_client_publish_get_ordering;
+    funcs.m_publish_init_resend_pacing_config = &cc_mqtt311_client_publish_init_resend_pacing_config;
+    funcs.m_publish_set_resend_pacing = &cc_mqtt311_client_publish_set_resend_pacing;
+    funcs.m_publish_get_resend_pacing = &cc_mqtt311_client_publish_get_resend_pacing;
+    funcs.m_publish_init_offline_queue_config = &cc_mqtt311_client_publish_init_offline_queue_config;
+    funcs.m_publish_set_offline_queue = &cc_mqtt311_client_publish_set_offline_queue;
+    funcs.m_publish_get_offline_queue = &cc_mqtt311_client_publish_get_offline_queue;
+    funcs.m_publish_get_priority_stats = &cc_mqtt311_client_publish_get_priority_stats;
+    funcs.m_publish_init_restore_config = &cc_mqtt311_client_publish_init_restore_config;
+    funcs.m_publish_restore = &cc_mqtt311_client_publish_restore;
     funcs.m_set_next_tick_program_callback = &cc_mqtt311_client_set_next_tick_program_callback;
     funcs.m_set_cancel_next_tick_wait_callback = &cc_mqtt311_client_set_cancel_next_tick_wait_callback;
     funcs.m_set_send_output_data_callback = &cc_mqtt311_client_set_send_output_data_callback;
     funcs.m_set_broker_disconnect_report_callback = &cc_mqtt311_client_set_broker_disconnect_report_callback;
     funcs.m_set_message_received_report_callback = &cc_mqtt311_client_set_message_received_report_callback;
     funcs.m_set_error_log_callback = &cc_mqtt311_client_set_error_log_callback;
+    funcs.m_set_session_store_callback = &cc_mqtt311_client_set_session_store_callback;
+    funcs.m_set_message_chunk_report_callback = &cc_mqtt311_client_set_message_chunk_report_callback;
+    funcs.m_set_topic_prefilter_callback = &cc_mqtt311_client_set_topic_prefilter_callback;
+    funcs.m_set_publish_queue_wakeup_callback = &cc_mqtt311_client_set_publish_queue_wakeup_callback;
+    funcs.m_publish_queue_set_capacity = &cc_mqtt311_client_publish_queue_set_capacity;
+    funcs.m_publish_queue_get_capacity = &cc_mqtt311_client_publish_queue_get_capacity;
+    funcs.m_publish_enqueue = &cc_mqtt311_client_publish_enqueue;
+    funcs.m_publish_queue_drain = &cc_mqtt311_client_publish_queue_drain;
     return funcs;
 }